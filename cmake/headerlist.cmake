@@ -4,16 +4,25 @@ set(headers ${headers}
 	src/ENB/ENB.h
 	src/ENB/ENBSeriesAPI.h
 	src/ENB/ENBSeriesSDK.h
+	src/FrameArena.h
 	src/Graphics.h
 	src/Hooks.h
+	src/ImGui/ComboFilter.h
+	src/ImGui/ComboWithFilter.h
 	src/ImGui/FormComboBox.h
+	src/ImGui/GlyphSet.h
 	src/ImGui/IconsFontAwesome6.h
 	src/ImGui/IconsFonts.h
+	src/ImGui/IdleValidity.h
 	src/ImGui/Renderer.h
+	src/ImGui/SearchIndex.h
 	src/ImGui/Styles.h
 	src/ImGui/Util.h
 	src/ImGui/Widgets.h
 	src/Input.h
+	src/InputEvent.h
+	src/InputRecorder.h
+	src/InputRecording.h
 	src/PCH.h
 	src/Papyrus.h
 	src/PhotoMode/Hotkeys.h
@@ -26,6 +35,8 @@ set(headers ${headers}
 	src/Screenshots/LoadScreen.h
 	src/Screenshots/Manager.h
 	src/Settings.h
+	src/StringPool.h
 	src/Translation.h
+	src/TranslationFile.h
 	src/Utilities/Utils.h
 )
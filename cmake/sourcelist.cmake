@@ -1,12 +1,20 @@
 set(sources ${sources}
+	src/FrameArena.cpp
 	src/Graphics.cpp
 	src/Hooks.cpp
+	src/ImGui/ComboFilter.cpp
+	src/ImGui/ComboWithFilter.cpp
+	src/ImGui/GlyphSet.cpp
 	src/ImGui/IconsFonts.cpp
+	src/ImGui/IdleValidity.cpp
 	src/ImGui/Renderer.cpp
+	src/ImGui/SearchIndex.cpp
 	src/ImGui/Styles.cpp
 	src/ImGui/Util.cpp
 	src/ImGui/Widgets.cpp
 	src/Input.cpp
+	src/InputRecorder.cpp
+	src/InputRecording.cpp
 	src/PCH.cpp
 	src/Papyrus.cpp
 	src/PhotoMode/Hotkeys.cpp
@@ -19,7 +27,9 @@ set(sources ${sources}
 	src/Screenshots/LoadScreen.cpp
 	src/Screenshots/Manager.cpp
 	src/Settings.cpp
+	src/StringPool.cpp
 	src/Translation.cpp
+	src/TranslationFile.cpp
 	src/Utilities/Utils.cpp
 	src/main.cpp
 )
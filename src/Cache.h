@@ -6,7 +6,8 @@ namespace Cache
 
 	namespace EditorID
 	{
-		inline std::string GetEditorID(RE::TESForm* a_form)
+		// resolves the EditorID through the game or po3_Tweaks. Interned, so the view stays valid
+		inline std::string_view LookupEditorID(RE::TESForm* a_form)
 		{
 			if (!a_form) {
 				return {};
@@ -39,15 +40,78 @@ namespace Cache
 			case RE::FormType::StoryManagerQuestNode:
 			case RE::FormType::StoryManagerEventNode:
 			case RE::FormType::SoundRecord:
-				return a_form->GetFormEditorID();
+				return StringPool::GetSingleton()->Intern(a_form->GetFormEditorID());
 			default:
 				static auto function = reinterpret_cast<_GetFormEditorID>(GetProcAddress(GetModuleHandle(L"po3_Tweaks"), "GetFormEditorID"));
 				if (function) {
-					return function(a_form->GetFormID());
+					if (const auto edid = function(a_form->GetFormID())) {
+						return StringPool::GetSingleton()->Intern(edid);
+					}
 				}
 				return {};
 			}
 		}
+
+		// EditorIDs memoized by FormID. Photo Mode form types are cached in bulk on data load, anything else on first use
+		class Manager final : public ISingleton<Manager>
+		{
+		public:
+			template <class... Forms>
+			void CacheEditorIDs()
+			{
+				const auto dataHandler = RE::TESDataHandler::GetSingleton();
+
+				std::unique_lock locker(lock);
+				(CacheFormArray(dataHandler->GetFormArray<Forms>()), ...);
+			}
+
+			std::string_view GetEditorID(RE::TESForm* a_form)
+			{
+				if (!a_form) {
+					return {};
+				}
+
+				// dynamic FormIDs can be reused by a different form
+				if (a_form->IsDynamicForm()) {
+					return LookupEditorID(a_form);
+				}
+
+				{
+					std::shared_lock locker(lock);
+					if (const auto it = editorIDs.find(a_form->GetFormID()); it != editorIDs.end()) {
+						return it->second;
+					}
+				}
+
+				const auto edid = LookupEditorID(a_form);
+
+				std::unique_lock locker(lock);
+				editorIDs.emplace(a_form->GetFormID(), edid);
+
+				return edid;
+			}
+
+		private:
+			template <class T>
+			void CacheFormArray(const RE::BSTArray<T*>& a_forms)
+			{
+				editorIDs.reserve(editorIDs.size() + a_forms.size());
+				for (const auto& form : a_forms) {
+					if (form && !form->IsDynamicForm()) {
+						editorIDs.emplace(form->GetFormID(), LookupEditorID(form));
+					}
+				}
+			}
+
+			// members
+			std::shared_mutex                 lock{};
+			Map<RE::FormID, std::string_view> editorIDs{};
+		};
+
+		inline std::string_view GetEditorID(RE::TESForm* a_form)
+		{
+			return Manager::GetSingleton()->GetEditorID(a_form);
+		}
 	}
 
 	namespace FreeCamera
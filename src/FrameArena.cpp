@@ -0,0 +1,43 @@
+#include "FrameArena.h"
+
+FrameArena::FrameArena(std::pmr::memory_resource* a_upstream) :
+	upstream(a_upstream),
+	buffer(static_cast<std::byte*>(a_upstream->allocate(initialSize, bufferAlignment)))
+{}
+
+FrameArena::~FrameArena()
+{
+	Reset();
+	upstream->deallocate(buffer, capacity, bufferAlignment);
+}
+
+void FrameArena::Reset()
+{
+	for (const auto& [ptr, bytes, alignment] : overflow) {
+		upstream->deallocate(ptr, bytes, alignment);
+	}
+	overflow.clear();
+
+	if (overflowBytes > 0) {
+		upstream->deallocate(buffer, capacity, bufferAlignment);
+		capacity = std::bit_ceil(capacity + overflowBytes);
+		buffer = static_cast<std::byte*>(upstream->allocate(capacity, bufferAlignment));
+		overflowBytes = 0;
+	}
+
+	used = 0;
+}
+
+void* FrameArena::do_allocate(std::size_t a_bytes, std::size_t a_alignment)
+{
+	const auto base = reinterpret_cast<std::uintptr_t>(buffer);
+	const auto offset = ((base + used + a_alignment - 1) & ~(a_alignment - 1)) - base;
+
+	if (offset + a_bytes <= capacity) {
+		used = offset + a_bytes;
+		return buffer + offset;
+	}
+
+	overflowBytes += a_bytes + a_alignment;
+	return overflow.emplace_back(upstream->allocate(a_bytes, a_alignment), a_bytes, a_alignment).ptr;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <memory_resource>
+
+// Bump allocator for temporaries of the Photo Mode draw path (labels, formatted values, small lists).
+// Everything is released at once when the frame ends in the StopTimer hook, so only use it from the render thread.
+// If a frame runs out of space the extra allocations go to the heap and the buffer grows on the next reset.
+class FrameArena final :
+	public ISingleton<FrameArena>,
+	public std::pmr::memory_resource
+{
+public:
+	FrameArena() :
+		FrameArena(std::pmr::new_delete_resource())
+	{}
+	explicit FrameArena(std::pmr::memory_resource* a_upstream);  // buffer and overflow allocations come from a_upstream
+	~FrameArena() override;
+
+	void Reset();
+
+private:
+	struct Overflow
+	{
+		// members
+		void*       ptr;
+		std::size_t bytes;
+		std::size_t alignment;
+	};
+
+	void* do_allocate(std::size_t a_bytes, std::size_t a_alignment) override;
+	void  do_deallocate(void*, std::size_t, std::size_t) override {}  // freed in Reset
+	bool  do_is_equal(const std::pmr::memory_resource& a_other) const noexcept override { return this == &a_other; }
+
+	static constexpr std::size_t initialSize{ 64 * 1024 };
+	static constexpr std::size_t bufferAlignment{ alignof(std::max_align_t) };
+
+	// members
+	std::pmr::memory_resource* upstream;
+	std::byte*                 buffer;
+	std::size_t                capacity{ initialSize };
+	std::size_t                used{ 0 };
+	std::vector<Overflow>      overflow{};
+	std::size_t                overflowBytes{ 0 };
+};
+
+using FrameString = std::pmr::string;
+template <class T>
+using FrameVector = std::pmr::vector<T>;
+template <class T>
+using FrameSet = std::pmr::set<T>;
+
+// FrameString str{ FrameAllocator() };
+inline std::pmr::polymorphic_allocator<> FrameAllocator()
+{
+	return FrameArena::GetSingleton();
+}
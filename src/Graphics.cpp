@@ -222,16 +222,24 @@ namespace Texture
 		return true;
 	}
 
-	void CompressTexture(const RE::BSGraphics::Renderer* a_this, const DirectX::ScratchImage& a_inputImage, DirectX::ScratchImage& a_outputImage)
+	void CompressTexture(ID3D11Device* a_device, const DirectX::ScratchImage& a_inputImage, DirectX::ScratchImage& a_outputImage)
 	{
 		// Compress texture
-		const ComPtr<ID3D11Device> device{ a_this->data.forwarder };
-
-		auto hr = DirectX::Compress(device.Get(), a_inputImage.GetImages(), 1, a_inputImage.GetMetadata(),
-			DXGI_FORMAT_BC7_UNORM,
-			DirectX::TEX_COMPRESS_BC7_QUICK,
-			0.0f,
-			a_outputImage);
+		// on the GPU if a device is given (never the game's, its immediate context isn't ours to use off the main thread)
+		HRESULT hr;
+		if (a_device) {
+			hr = DirectX::Compress(a_device, a_inputImage.GetImages(), 1, a_inputImage.GetMetadata(),
+				DXGI_FORMAT_BC7_UNORM,
+				DirectX::TEX_COMPRESS_BC7_QUICK,
+				0.0f,
+				a_outputImage);
+		} else {
+			hr = DirectX::Compress(a_inputImage.GetImages(), 1, a_inputImage.GetMetadata(),
+				DXGI_FORMAT_BC7_UNORM,
+				DirectX::TEX_COMPRESS_BC7_QUICK | DirectX::TEX_COMPRESS_PARALLEL,
+				DirectX::TEX_THRESHOLD_DEFAULT,
+				a_outputImage);
+		}
 		if (FAILED(hr)) {
 			logger::info("Failed to compress dds");
 		}
@@ -25,7 +25,7 @@ namespace Texture
 
 	bool OilPaintingFilter(const DirectX::Image* a_srcImage, std::int32_t a_radius, float a_intensity, DirectX::ScratchImage& a_outImage);
 
-	void CompressTexture(const RE::BSGraphics::Renderer* a_this, const DirectX::ScratchImage& a_inputImage, DirectX::ScratchImage& a_outputImage);
+	void CompressTexture(ID3D11Device* a_device, const DirectX::ScratchImage& a_inputImage, DirectX::ScratchImage& a_outputImage);
 
 	void SaveToDDS(const DirectX::ScratchImage& a_inputImage, std::string_view a_path);
 	void SaveToPNG(const DirectX::ScratchImage& a_inputImage, std::string_view a_path);
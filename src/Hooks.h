@@ -2,7 +2,7 @@
 
 namespace PhotoMode
 {
-	inline StringMap<RE::TESIdleForm*> cachedIdles;
+	inline Map<std::string_view, RE::TESIdleForm*> cachedIdles;  // interned EditorIDs
 
 	void InstallHooks();
 }
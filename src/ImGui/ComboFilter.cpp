@@ -0,0 +1,119 @@
+#include "ComboFilter.h"
+
+#include <rapidfuzz/rapidfuzz_all.hpp>
+
+namespace ImGui
+{
+	void ComboFilter::SetSearchIndex(const SearchIndex* a_index, std::int32_t a_offset)
+	{
+		if (searchIndex != a_index || searchOffset != a_offset) {
+			Reset();
+			searchIndex = a_index;
+			searchOffset = a_offset;
+		}
+	}
+
+	void ComboFilter::CancelSearch()
+	{
+		if (worker.joinable()) {
+			worker.request_stop();
+			worker.join();
+		}
+		search.reset();
+		pendingPattern.clear();
+	}
+
+	void ComboFilter::Reset()
+	{
+		CancelSearch();
+
+		pattern.clear();
+		results.clear();
+		items = nullptr;
+		itemCount = 0;
+	}
+
+	bool ComboFilter::IsSearching() const
+	{
+		return search != nullptr;
+	}
+
+	ComboFilter::Results ComboFilter::Score(std::string_view a_pattern, const std::vector<std::int32_t>& a_candidates, std::span<const std::string_view> a_items, const std::stop_token& a_token)
+	{
+		Results scores;
+
+		const rapidfuzz::fuzz::CachedPartialTokenRatio<char> scorer(a_pattern);
+		for (std::size_t i = 0; i < a_candidates.size(); ++i) {
+			if ((i & 255) == 0 && a_token.stop_requested()) {
+				return {};
+			}
+			const auto idx = a_candidates[i];
+			if (const auto score = scorer.similarity(a_items[idx], scoreCutoff); score >= scoreCutoff) {
+				scores.push_back(std::make_pair(idx, score));
+			}
+		}
+
+		std::ranges::sort(scores, [](const auto& a, const auto& b) {
+			return a.second != b.second ? b.second < a.second : a.first < b.first;
+		});
+
+		return scores;
+	}
+
+	const ComboFilter::Results& ComboFilter::Update(std::string_view a_pattern, std::span<const std::string_view> a_items)
+	{
+		if (items != a_items.data() || itemCount != a_items.size()) {
+			Reset();
+			items = a_items.data();
+			itemCount = a_items.size();
+		}
+
+		// pick up finished background search
+		if (search) {
+			std::unique_lock locker(search->lock);
+			if (search->completed) {
+				results = std::move(*search->completed);
+				pattern = std::move(pendingPattern);
+				locker.unlock();
+				search.reset();
+			}
+		}
+
+		if (a_pattern == pattern || (search && a_pattern == pendingPattern)) {
+			return results;
+		}
+
+		// every item is rescored, even if the pattern was only appended to: partial_token_ratio can rise when it grows,
+		// e.g. "a" scores 0 against "cc b" but "ac" scores 66
+		std::vector<std::int32_t> candidates;
+		if (searchIndex && searchIndex->IsBuilt() && searchIndex->GetCandidates(a_pattern, scoreCutoff, searchOffset, static_cast<std::int32_t>(a_items.size()), candidates)) {
+			// only score items that can reach the cutoff. The index can cover more than the items, e.g. a whole catalogue for one mod's range
+			for (auto& idx : candidates) {
+				idx -= searchOffset;
+			}
+		} else {
+			// or everything if there is no index, or the pattern is only whitespace
+			candidates.resize(a_items.size());
+			std::iota(candidates.begin(), candidates.end(), 0);
+		}
+
+		CancelSearch();
+
+		if (candidates.size() < asyncThreshold) {
+			results = Score(a_pattern, candidates, a_items);
+			pattern = a_pattern;
+		} else {
+			pendingPattern = a_pattern;
+			search = std::make_shared<Search>();
+			worker = std::jthread([search = search, searchPattern = std::string(a_pattern), searchCandidates = std::move(candidates), searchItems = std::vector(a_items.begin(), a_items.end())](std::stop_token a_token) {
+				auto scores = Score(searchPattern, searchCandidates, searchItems, a_token);
+				if (!a_token.stop_requested()) {
+					std::scoped_lock locker(search->lock);
+					search->completed = std::move(scores);
+				}
+			});
+		}
+
+		return results;
+	}
+}
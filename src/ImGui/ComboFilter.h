@@ -0,0 +1,58 @@
+#pragma once
+
+#include "SearchIndex.h"
+
+namespace ImGui
+{
+	// Ranked filter results of a ComboWithFilter, kept between frames.
+	// Large item lists are scored on a worker thread, and the last completed results are shown until it finishes.
+	// The worker owns a copy of the item views and shares its results through a shared_ptr, so the filter can be moved while it runs.
+	class ComboFilter
+	{
+	public:
+		using Results = std::vector<std::pair<int, double>>;  // item index, score
+
+		ComboFilter() = default;
+		ComboFilter(const ComboFilter&) = delete;
+		ComboFilter(ComboFilter&&) noexcept = default;
+		~ComboFilter() = default;
+
+		ComboFilter& operator=(const ComboFilter&) = delete;
+		ComboFilter& operator=(ComboFilter&&) noexcept = default;
+
+		void SetSearchIndex(const SearchIndex* a_index, std::int32_t a_offset = 0);  // offset is the index of the first item in a_index
+		void Reset();  // must be called before the item list is modified
+
+		// rescoring is skipped if the pattern and items are unchanged
+		const Results& Update(std::string_view a_pattern, std::span<const std::string_view> a_items);
+
+		[[nodiscard]] bool IsSearching() const;
+
+	private:
+		static constexpr std::size_t asyncThreshold{ 4096 };
+		static constexpr double      scoreCutoff{ 65.0 };
+
+		struct Search
+		{
+			std::mutex             lock;
+			std::optional<Results> completed;
+		};
+
+		static Results Score(std::string_view a_pattern, const std::vector<std::int32_t>& a_candidates, std::span<const std::string_view> a_items, const std::stop_token& a_token = {});
+
+		void CancelSearch();
+
+		// members
+		const SearchIndex*      searchIndex{ nullptr };
+		std::int32_t            searchOffset{ 0 };
+		const std::string_view* items{ nullptr };
+		std::size_t             itemCount{ 0 };
+
+		std::string pattern{};  // pattern of the current results
+		Results     results{};
+
+		std::string             pendingPattern{};  // pattern being scored by the worker
+		std::shared_ptr<Search> search{};          // null if no search is running
+		std::jthread            worker{};          // declared last so that it is joined first
+	};
+}
@@ -0,0 +1,201 @@
+#include "ComboWithFilter.h"
+
+namespace ImGui
+{
+	// Source: https://gist.github.com/idbrii/5ddb2135ca122a0ec240ce046d9e6030
+	//
+	// Author: David Briscoe
+	//
+	// Modified ComboWithFilter with rapidFuzz
+	// Using dear imgui, v1.89 WIP
+	//
+	// Adds arrow/pgup/pgdn navigation, Enter to confirm, max_height_in_items, and
+	// fixed focus on open and avoids drawing past window edges.
+	//
+	// Licensed as CC0/public domain.
+	//
+	// Posted in issue: https://github.com/ocornut/imgui/issues/1658#issuecomment-1086193100
+
+	bool ComboWithFilter(const char* label, int* current_item, std::span<const std::string_view> items, ComboFilter* filter, int popup_max_height_in_items)
+	{
+		ImGuiContext& g = *GImGui;
+
+		ImGuiWindow* window = GetCurrentWindow();
+		if (window->SkipItems) {
+			return false;
+		}
+
+		const int items_count = static_cast<int>(items.size());
+
+		// Use imgui Items_ getters to support more input formats.
+		const char* preview_value = nullptr;
+		if (*current_item >= 0 && *current_item < items_count) {
+			preview_value = items[*current_item].data();
+		}
+
+		static int  focus_idx = -1;
+		static char pattern_buffer[MAX_PATH] = { 0 };
+
+		bool value_changed = false;
+
+		const ImGuiID id = window->GetID(label);
+		const ImGuiID popup_id = ImHashStr("##ComboPopup", 0, id);  // copied from BeginCombo
+		const bool    is_already_open = IsPopupOpen(popup_id, ImGuiPopupFlags_None);
+		const bool    is_filtering = is_already_open && pattern_buffer[0] != '\0';
+
+		int show_count = items_count;
+
+		static Map<ImGuiID, ComboFilter>  default_filters;  // one per combo, so that combos without a filter don't share results
+		static const ComboFilter::Results no_scores;
+
+		// only looked up while filtering, so closed combos never add an entry
+		ComboFilter* active_filter = filter;
+		if (is_filtering && !active_filter) {
+			active_filter = &default_filters[id];
+		}
+
+		// Filter before opening to ensure we show the correct size window.
+		// We won't get in here unless the popup is open.
+		const auto& itemScoreVector = is_filtering ? active_filter->Update(pattern_buffer, items) : no_scores;
+		if (is_filtering) {
+			const int current_score_idx = IndexOfKey(itemScoreVector, focus_idx);
+			if (current_score_idx < 0 && !itemScoreVector.empty()) {
+				focus_idx = itemScoreVector[0].first;
+			}
+			show_count = static_cast<int>(itemScoreVector.size());
+		}
+
+		// Define the height to ensure our size calculation is valid.
+		if (popup_max_height_in_items == -1) {
+			popup_max_height_in_items = 5;
+		}
+		popup_max_height_in_items = ImMin(popup_max_height_in_items, show_count);
+
+		if (!(g.NextWindowData.Flags & ImGuiNextWindowDataFlags_HasSizeConstraint)) {
+			const int numItems = popup_max_height_in_items + 2;  // extra for search bar
+			SetNextWindowSizeConstraints(ImVec2(0, 0), ImVec2(FLT_MAX,
+														   CalcMaxPopupHeightFromItemCount(numItems)));
+		}
+
+		if (!BeginCombo(label, preview_value, ImGuiComboFlags_None)) {
+			return false;
+		}
+
+		if (!is_already_open) {
+			focus_idx = *current_item;
+			memset(pattern_buffer, 0, IM_ARRAYSIZE(pattern_buffer));
+		}
+
+		ImGui::PushStyleColor(ImGuiCol_FrameBg, static_cast<ImVec4>(ImColor(0, 0, 0, 255)));
+		ImGui::PushStyleColor(ImGuiCol_Text, static_cast<ImVec4>(ImColor(255, 255, 255, 204)));
+		ImGui::PushStyleColor(ImGuiCol_NavHighlight, static_cast<ImVec4>(ImColor(0, 0, 0, 0)));
+		ImGui::PushItemWidth(-FLT_MIN);
+		// Filter input
+		if (!is_already_open) {
+			ImGui::SetKeyboardFocusHere();
+		}
+		InputText("##ComboWithFilter_inputText", pattern_buffer, MAX_PATH, ImGuiInputTextFlags_AutoSelectAll);
+
+		if (is_filtering && active_filter->IsSearching()) {
+			// still scoring, the previous results are shown meanwhile
+			static constexpr std::array searching_text{ ".", "..", "..." };
+			const auto  text = searching_text[static_cast<std::size_t>(GetTime() * 3.0) % searching_text.size()];
+			const auto  text_size = CalcTextSize(text);
+			const auto& input_rect = g.LastItemData.Rect;
+			GetWindowDrawList()->AddText(ImVec2(input_rect.Max.x - text_size.x - g.Style.FramePadding.x, input_rect.Min.y + g.Style.FramePadding.y), GetColorU32(ImGuiCol_TextDisabled), text);
+		}
+
+		ImGui::PopStyleColor(3);
+
+		int move_delta = 0;
+		if (IsKeyPressed(ImGuiKey_UpArrow) || IsKeyPressed(ImGuiKey_GamepadDpadUp)) {
+			--move_delta;
+		} else if (IsKeyPressed(ImGuiKey_DownArrow) || IsKeyPressed(ImGuiKey_GamepadDpadDown)) {
+			++move_delta;
+		} else if (IsKeyPressed(ImGuiKey_PageUp)) {
+			move_delta -= popup_max_height_in_items;
+		} else if (IsKeyPressed(ImGuiKey_PageDown)) {
+			move_delta += popup_max_height_in_items;
+		}
+
+		if (move_delta != 0) {
+			if (is_filtering) {
+				int current_score_idx = IndexOfKey(itemScoreVector, focus_idx);
+				if (current_score_idx >= 0) {
+					const int count = static_cast<int>(itemScoreVector.size());
+					current_score_idx = ImClamp(current_score_idx + move_delta, 0, count - 1);
+					focus_idx = itemScoreVector[current_score_idx].first;
+				}
+			} else {
+				focus_idx = ImClamp(focus_idx + move_delta, 0, items_count - 1);
+			}
+			RE::PlaySound("UIMenuPrevNext");
+		}
+
+		// Copied from ListBoxHeader
+		// If popup_max_height_in_items == -1, default height is maximum 7.
+		const float height_in_items_f = (popup_max_height_in_items < 0 ? ImMin(items_count, 7) :
+                                                                         popup_max_height_in_items) +
+		                                0.25f;
+		ImVec2 size;
+		size.x = 0.0f;
+		size.y = GetTextLineHeightWithSpacing() * height_in_items_f + g.Style.FramePadding.y * 2.0f;
+
+		ImGui::PushStyleColor(ImGuiCol_NavHighlight, static_cast<ImVec4>(ImColor(0, 0, 0, 0)));
+		if (ImGui::BeginListBox("##ComboWithFilter_itemList", size)) {
+			// only submit visible rows, plus the focused row when it has to be scrolled into view
+			const int  focus_row = is_filtering ? IndexOfKey(itemScoreVector, focus_idx) : focus_idx;
+			const bool scroll_to_focus = move_delta != 0 || IsWindowAppearing();
+
+			ImGuiListClipper clipper;
+			clipper.Begin(show_count);
+			if (scroll_to_focus && focus_row >= 0 && focus_row < show_count) {
+				clipper.IncludeItemByIndex(focus_row);
+			}
+			while (clipper.Step()) {
+				for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+					int idx = is_filtering ? itemScoreVector[i].first : i;
+					PushID(reinterpret_cast<void*>(static_cast<intptr_t>(idx)));
+					const bool  item_selected = (idx == focus_idx);
+					const char* item_text = items[idx].data();
+					if (Selectable(item_text, item_selected)) {
+						value_changed = true;
+						*current_item = idx;
+						CloseCurrentPopup();
+						RE::PlaySound("UIMenuFocus");
+					}
+
+					if (item_selected) {
+						SetItemDefaultFocus();
+						// SetItemDefaultFocus doesn't work so also check IsWindowAppearing.
+						if (scroll_to_focus) {
+							SetScrollHereY();
+						}
+					}
+					PopID();
+				}
+			}
+			ImGui::EndListBox();
+
+			if (IsKeyPressed(ImGuiKey_Enter) || IsKeyPressed(ImGuiKey_Space) || IsKeyPressed(ImGuiKey_NavGamepadActivate)) {
+				value_changed = true;
+				*current_item = focus_idx;
+				CloseCurrentPopup();
+				RE::PlaySound("UIMenuOK");
+			} else if (IsKeyPressed(ImGuiKey_Escape) || IsKeyPressed(ImGuiKey_NavGamepadCancel)) {
+				value_changed = false;
+				CloseCurrentPopup();
+				RE::PlaySound("UIMenuCancel");
+			}
+		}
+		ImGui::PopStyleColor();
+		ImGui::PopItemWidth();
+		ImGui::EndCombo();
+
+		if (value_changed) {
+			MarkItemEdited(g.LastItemData.ID);
+		}
+
+		return value_changed;
+	}
+}
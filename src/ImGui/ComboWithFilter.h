@@ -0,0 +1,10 @@
+#pragma once
+
+#include "ComboFilter.h"
+#include "Util.h"
+
+namespace ImGui
+{
+	// items must view null-terminated strings
+	bool ComboWithFilter(const char* label, int* current_item, std::span<const std::string_view> items, ComboFilter* filter = nullptr, int popup_max_height_in_items = -1);
+}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Hooks.h"
+#include "ImGui/IconsFonts.h"
+#include "ImGui/IdleValidity.h"
 #include "ImGui/Widgets.h"
 
 namespace ImGui
@@ -9,6 +11,191 @@ namespace ImGui
 	constexpr auto ffForms = "$PM_FF_Forms"sv;
 	constexpr auto InvItems = "$PM_Items"sv;
 
+	// non-owning view of forms and their names
+	template <class T>
+	struct FormSpan
+	{
+		std::span<const std::string_view> names{};
+		std::span<T* const>               forms{};
+		const SearchIndex*                searchIndex{ nullptr };
+		std::int32_t                      searchOffset{ 0 };  // index of names[0] in searchIndex
+	};
+
+	// forms and their names, in insertion order. Each form is listed once, even if its name isn't unique
+	template <class T>
+	class FormList
+	{
+	public:
+		void AddForm(std::string_view a_edid, T* a_form)
+		{
+			if (const auto [it, inserted] = formIndices.try_emplace(a_form->GetFormID(), static_cast<std::int32_t>(forms.size())); inserted) {
+				edids.push_back(StringPool::GetSingleton()->Intern(a_edid));
+				forms.push_back(a_form);
+				searchIndex.Clear();
+			}
+		}
+		void RemoveForm(const T* a_form)
+		{
+			const auto it = formIndices.find(a_form->GetFormID());
+			if (it == formIndices.end()) {
+				return;
+			}
+			const auto idx = it->second;
+			formIndices.erase(it);
+			edids.erase(edids.begin() + idx);
+			forms.erase(forms.begin() + idx);
+			for (auto& [formID, formIdx] : formIndices) {
+				if (formIdx > idx) {
+					--formIdx;
+				}
+			}
+			searchIndex.Clear();
+		}
+		void Clear()
+		{
+			formIndices.clear();
+			edids.clear();
+			forms.clear();
+			searchIndex.Clear();
+		}
+		void BuildSearchIndex()
+		{
+			if (!searchIndex.IsBuilt()) {
+				searchIndex.Build(edids);
+			}
+		}
+
+		FormSpan<T> GetSpan() const
+		{
+			return { edids, forms, &searchIndex };
+		}
+		std::int32_t GetCount() const
+		{
+			return static_cast<std::int32_t>(forms.size());
+		}
+
+	private:
+		// members
+		Map<RE::FormID, std::int32_t> formIndices{};
+		std::vector<std::string_view> edids{};  // interned
+		std::vector<T*>               forms{};
+		SearchIndex                   searchIndex{};
+	};
+
+	// selection and filter state of a combo box over a FormSpan
+	template <class T>
+	class FormListView
+	{
+	public:
+		void Reset(std::int32_t a_index = 0)
+		{
+			index = a_index;
+			SetValid(false);
+		}
+		void ResetFilter()
+		{
+			filter.Reset();
+		}
+		void Clear()
+		{
+			filter.Reset();
+			index = 0;
+			valid = false;
+			validEdids.clear();
+			validForms.clear();
+			validSearchIndex.Clear();
+			validEntry = nullptr;
+			validChecked = 0;
+		}
+		void SetValid(bool a_valid)
+		{
+			valid = a_valid;
+		}
+
+		T* GetComboWithFilterResult(const FormSpan<T>& a_forms, RE::Actor* a_actor = nullptr)
+		{
+			std::span<const std::string_view> names = a_forms.names;
+
+			if constexpr (std::is_same_v<T, RE::TESIdleForm>) {
+				UpdateValidForms(a_forms, a_actor);
+				names = validEdids;
+				filter.SetSearchIndex(validSearchIndex.IsBuilt() ? &validSearchIndex : nullptr);
+			} else {
+				filter.SetSearchIndex(a_forms.searchIndex, a_forms.searchOffset);
+			}
+
+			if (ImGui::ComboWithFilter("##forms", &index, names, &filter)) {
+				// avoid losing focus
+				ImGui::SetKeyboardFocusHere(-1);
+				if constexpr (std::is_same_v<T, RE::TESIdleForm>) {
+					return validForms[index];
+				} else {
+					return a_forms.forms[index];
+				}
+			}
+			return nullptr;
+		}
+
+	private:
+		// idles are checked over several frames, so the list grows until the shared validity entry is complete
+		void UpdateValidForms(const FormSpan<T>& a_forms, RE::Actor* a_actor)
+		{
+			if (!a_actor) {
+				a_actor = RE::PlayerCharacter::GetSingleton();
+			}
+
+			const auto& validity = IdleValidity::GetSingleton()->Update(a_actor);
+
+			// the actor's key changes if it e.g. draws its weapon
+			if (!valid || validEntry != &validity) {
+				SetValid(true);
+				validEntry = &validity;
+
+				filter.Reset();
+				validSearchIndex.Clear();
+				validEdids.clear();
+				validForms.clear();
+				validChecked = 0;
+			}
+
+			if (validity.indices.size() > validChecked) {
+				// a_forms is a range of the idle catalogue, starting at searchOffset
+				const auto begin = a_forms.searchOffset;
+				const auto end = begin + static_cast<std::int32_t>(a_forms.forms.size());
+
+				const auto newIndices = std::span(validity.indices).subspan(validChecked);
+				validChecked = validity.indices.size();
+
+				if (std::ranges::any_of(newIndices, [&](std::int32_t a_idx) { return a_idx >= begin && a_idx < end; })) {
+					// the filter may be scoring the current list on its worker
+					filter.Reset();
+					for (const auto& idx : newIndices) {
+						if (idx >= begin && idx < end) {
+							validEdids.push_back(a_forms.names[idx - begin]);
+							validForms.push_back(a_forms.forms[idx - begin]);
+						}
+					}
+				}
+			}
+
+			if (validity.complete && !validSearchIndex.IsBuilt()) {
+				validSearchIndex.Build(validEdids);
+			}
+		}
+
+		// members
+		std::int32_t index{};
+		bool         valid{ false };
+		ComboFilter  filter{};
+
+		// idles usable by the actor
+		std::vector<std::string_view> validEdids{};
+		std::vector<T*>               validForms{};
+		SearchIndex                   validSearchIndex{};
+		const IdleValidity::Entry*    validEntry{ nullptr };
+		std::size_t                   validChecked{ 0 };  // indices of validEntry already copied
+	};
+
 	template <class T>
 	class FormComboBox
 	{
@@ -18,101 +205,80 @@ namespace ImGui
 			name(std::move(a_name))
 		{}
 
-		void AddForm(const std::string& a_edid, T* a_form)
+		void AddForm(std::string_view a_edid, T* a_form)
 		{
-			if (edidForms.emplace(a_edid, a_form).second) {
-				edids.push_back(a_edid);
-			}
+			view.ResetFilter();
+			forms.AddForm(a_edid, a_form);
+		}
+		void RemoveForm(const T* a_form)
+		{
+			// indices past the removed form shift down, so the selection can't be kept
+			view.ResetFilter();
+			view.Reset();
+			forms.RemoveForm(a_form);
 		}
-		void InitForms(RE::TESObjectREFR::InventoryItemMap a_items, RE::FormType a_type)
+		void InitForms(const RE::TESObjectREFR::InventoryItemMap& a_items, RE::FormType a_type)
 		{
 			for (const auto& a_item : a_items) {
 				//logger::info(FMT_STRING("{}: {}"), EditorID::GetEditorID(a_item.first), a_item.first->GetFormType());
 				if (a_item.first->Is(a_type) && a_item.first->GetPlayable() && a_item.second.first > 0)
 				{
-					const char* name = nullptr;
-					auto gmst = RE::GameSettingCollection::GetSingleton();
-					auto sMissingName = gmst ? gmst->GetSetting("sMissingName") : nullptr;
-					name = sMissingName ? sMissingName->GetString() : "";
-
-					if (a_item.second.second->GetDisplayName() == name)
-						AddForm(EditorID::GetEditorID(a_item.first), a_item.first);
-					else
-						AddForm(a_item.second.second->GetDisplayName(), a_item.first);
+					AddInventoryItem(a_item.first, a_item.second.second.get());
 				}
 			}
 			//name = InvItems;
 		}
-		void InitMagic(std::vector<RE::SpellItem*> a_spells) 
+		// named like the inventory menu shows it (renamed/enchanted items included), or by EditorID if it has no name
+		void AddInventoryItem(T* a_item, RE::InventoryEntryData* a_entry)
+		{
+			const auto gmst = RE::GameSettingCollection::GetSingleton();
+			const auto sMissingName = gmst ? gmst->GetSetting("sMissingName") : nullptr;
+			const auto missingName = std::string_view(sMissingName ? sMissingName->GetString() : "");
+
+			const std::string_view name = a_entry ? a_entry->GetDisplayName() : a_item->GetName();
+			if (name.empty() || name == missingName) {
+				AddForm(EditorID::GetEditorID(a_item), a_item);
+			} else {
+				// player-given names aren't in the form names the fonts were baked with
+				MANAGER(IconFont)->AddGlyphs(name);
+				AddForm(name, a_item);
+			}
+		}
+		void InitMagic(std::vector<RE::SpellItem*> a_spells)
 		{
 			for (const auto& a_spell : a_spells)
 			{
-				if (a_spell->GetSpellType() == RE::MagicSystem::SpellType::kSpell && a_spell->GetPlayable()) 
+				if (a_spell->GetSpellType() == RE::MagicSystem::SpellType::kSpell && a_spell->GetPlayable())
 				{
 					AddForm(a_spell->GetName(), a_spell);
 				}
 			}
 		}
-		void UpdateValidForms(RE::Actor* a_actor = nullptr)
-		{
-			if (valid) {
-				return;
-			}
-
-			SetValid(true);
-
-			if constexpr (std::is_same_v<T, RE::TESIdleForm>) {
-				if (!a_actor) {
-					a_actor = RE::PlayerCharacter::GetSingleton();
-				}
-				edids.clear();
-				for (auto& [edid, idle] : edidForms) {
-					if (a_actor->CanUseIdle(idle) && idle->CheckConditions(a_actor, nullptr, false)) {
-						edids.push_back(edid);
-					}
-				}
-			}
-		}
 		void ResetIndex()
 		{
-			if constexpr (std::is_same_v<T, RE::TESWeather>) {
-				const auto it = edidForms.find(EditorID::GetEditorID(RE::Sky::GetSingleton()->currentWeather));
-				if (it != edidForms.end()) {
-					index = static_cast<std::int32_t>(std::distance(edidForms.begin(), it));
-				} else {
-					index = 0;
-				}
-			} else {
-				index = 0;
-			}
+			view.Reset();
 		}
 		void SetValid(bool a_valid)
 		{
-			valid = a_valid;
+			view.SetValid(a_valid);
 		}
 		int GetCount()
 		{
-			return edids.size();
+			return forms.GetCount();
 		}
 		void ResetAndClear()
 		{
-			index = 0;
-			edidForms.clear();
-			edids.clear();
+			view.Clear();
+			forms.Clear();
 		}
 
 		T* GetComboWithFilterResult(RE::Actor* a_actor = nullptr)
 		{
-			UpdateValidForms(a_actor);
-			if (ImGui::ComboWithFilter("##forms", &index, edids)) {
-				// avoid losing focus
-				ImGui::SetKeyboardFocusHere(-1);
-				return edidForms.find(edids[index])->second;
-			}
-			return nullptr;
+			forms.BuildSearchIndex();
+			return view.GetComboWithFilterResult(forms.GetSpan(), a_actor);
 		}
-		
-		void GetFormResultFromCombo(std::function<void(T*)> a_func, RE::Actor* a_actor = nullptr)
+
+		void GetFormResultFromCombo(std::invocable<T*> auto&& a_func, RE::Actor* a_actor = nullptr)
 		{
 			T* formResult;
 
@@ -149,79 +315,184 @@ namespace ImGui
 		std::string name;
 		bool        translated{ false };
 
-		StringMap<T*>            edidForms{};
-		std::vector<std::string> edids{};
-		std::int32_t             index{};
-		bool                     valid{ false };
+		FormList<T>     forms{};
+		FormListView<T> view{};
 	};
 
-	// modName, forms
+	// every form of a type, stored once and sorted by (mod, name). Each mod is a [begin, end) range and ALL is the whole array.
+	// Built once and shared by all FormComboBoxFiltered of that type
 	template <class T>
-	class FormComboBoxFiltered
+	class FormCatalogue : public ISingleton<FormCatalogue<T>>
 	{
 	public:
-		FormComboBoxFiltered(std::string a_name) :
-			name(std::move(a_name))
-		{}
-
-		void AddForm(const std::string& a_edid, T* a_form)
+		// reads the engine's form arrays and load order, so it must be called on the main thread before Init
+		void Collect()
 		{
-			std::string modName;
-			if (auto file = a_form->GetFile(0)) {
-				modName = file->fileName;
+			const auto dataHandler = RE::TESDataHandler::GetSingleton();
+
+			if constexpr (!std::is_same_v<T, RE::TESIdleForm>) {
+				const auto& formArray = dataHandler->GetFormArray<T>();
+				entries.reserve(formArray.size());
+				for (const auto& form : formArray) {
+					entries.push_back({ form->GetFile(0), EditorID::GetEditorID(form), form });
+				}
 			} else {
-				modName = ffForms;
+				entries.reserve(PhotoMode::cachedIdles.size());
+				for (auto& [edid, form] : PhotoMode::cachedIdles) {
+					entries.push_back({ form->GetFile(0), edid, form });
+				}
+			}
+
+			loadOrder.reserve(dataHandler->files.size());
+			for (const auto& file : dataHandler->files) {
+				loadOrder.emplace_back(file, file->fileName);
 			}
+		}
 
-			modNameForms[allMods].AddForm(a_edid, a_form);
-			modNameForms[modName].AddForm(a_edid, a_form);
+		// only sorts and indexes the collected forms, so it can run on a worker. Thread-safe, callers block until the first build has finished
+		void Init()
+		{
+			std::call_once(initialized, [this] { Build(); });
 		}
-		void InitForms()
+
+		std::span<const std::string_view> GetModNames() const
 		{
-			if (modNameForms.empty()) {
-				if constexpr (!std::is_same_v<T, RE::TESIdleForm>) {
-					for (const auto& form : RE::TESDataHandler::GetSingleton()->GetFormArray<T>()) {
-						AddForm(EditorID::GetEditorID(form), form);
-					}
-				} else {
-					for (auto& [edid, form] : PhotoMode::cachedIdles) {
-						AddForm(edid, form);
-					}
+			return modNames;
+		}
+		FormSpan<T> GetForms(std::int32_t a_modIndex) const
+		{
+			const auto [begin, end] = modRanges[a_modIndex];
+			return {
+				std::span(edids).subspan(begin, end - begin),
+				std::span(forms).subspan(begin, end - begin),
+				&searchIndex,
+				begin
+			};
+		}
+		// index of the form within the mod's range, or -1
+		std::int32_t GetIndex(std::int32_t a_modIndex, const T* a_form) const
+		{
+			if (const auto it = formIndices.find(a_form); it != formIndices.end()) {
+				if (const auto [begin, end] = modRanges[a_modIndex]; it->second >= begin && it->second < end) {
+					return it->second - begin;
 				}
 			}
+			return -1;
+		}
+
+	private:
+		struct Entry
+		{
+			const RE::TESFile* file;
+			std::string_view   edid;  // interned
+			T*                 form;
+			std::uint32_t      mod{ 0 };
+		};
 
+		void Build()
+		{
 			// ALL
 			// ...mods
 			// FF FORMS
 
-			if (modNames.empty()) {
-				modNames.reserve(modNameForms.size());
-				modNames.emplace_back(TRANSLATE_S(allMods));
+			Map<const RE::TESFile*, std::uint32_t> fileMods;
+			for (const auto& entry : entries) {
+				fileMods.try_emplace(entry.file, 0);
+			}
 
-				for (const auto& file : RE::TESDataHandler::GetSingleton()->files) {
-					if (modNameForms.contains(file->fileName)) {
-						modNames.emplace_back(file->fileName);
-					}
+			modNames.emplace_back(TRANSLATE_S(allMods));
+			for (const auto& [file, fileName] : loadOrder) {
+				if (const auto it = fileMods.find(file); it != fileMods.end()) {
+					it->second = static_cast<std::uint32_t>(modNames.size());
+					modNames.emplace_back(fileName);
+				}
+			}
+			if (const auto it = fileMods.find(nullptr); it != fileMods.end()) {
+				it->second = static_cast<std::uint32_t>(modNames.size());
+				modNames.emplace_back(TRANSLATE_S(ffForms));
+			}
+
+			for (auto& entry : entries) {
+				entry.mod = fileMods.find(entry.file)->second;
+			}
+
+			// one entry per form, and one per EditorID within a mod, the first collected is kept.
+			// Different mods can reuse an EditorID, and forms without one can't be told apart by it, so those are all kept
+			ankerl::unordered_dense::set<const T*>                      seenForms;
+			std::vector<ankerl::unordered_dense::set<std::string_view>> seenEdids(modNames.size());
+			std::erase_if(entries, [&](const Entry& a_entry) {
+				if (!seenForms.insert(a_entry.form).second) {
+					return true;
 				}
-				if (modNameForms.contains(ffForms)) {
-					containsFF = true;
-					modNames.emplace_back(TRANSLATE_S(ffForms));
+				return !a_entry.edid.empty() && !seenEdids[a_entry.mod].insert(a_entry.edid).second;
+			});
+
+			std::ranges::sort(entries, [](const Entry& a, const Entry& b) {
+				return a.mod != b.mod ? a.mod < b.mod : _stricmp(a.edid.data(), b.edid.data()) < 0;
+			});
+
+			edids.reserve(entries.size());
+			forms.reserve(entries.size());
+			modRanges.assign(modNames.size(), { 0, 0 });
+
+			for (auto& entry : entries) {
+				const auto idx = static_cast<std::int32_t>(forms.size());
+				auto&      range = modRanges[entry.mod];
+				if (range.first == range.second) {
+					range.first = idx;
 				}
+				range.second = idx + 1;
+
+				edids.push_back(entry.edid);
+				forms.push_back(entry.form);
+			}
+			modRanges[0] = { 0, static_cast<std::int32_t>(forms.size()) };
+
+			formIndices.reserve(forms.size());
+			for (std::int32_t i = 0; i < static_cast<std::int32_t>(forms.size()); ++i) {
+				formIndices.emplace(forms[i], i);
 			}
 
+			searchIndex.Build(edids);
+
+			entries = {};
+			loadOrder = {};
+		}
+
+		// members
+		std::vector<Entry>                                           entries{};    // collected on the main thread
+		std::vector<std::pair<const RE::TESFile*, std::string_view>> loadOrder{};  // file, file name
+
+		std::vector<std::string_view>                      edids{};  // interned
+		std::vector<T*>                                    forms{};
+		Map<const T*, std::int32_t>                        formIndices{};
+		SearchIndex                                        searchIndex{};
+		std::vector<std::string_view>                      modNames{};
+		std::vector<std::pair<std::int32_t, std::int32_t>> modRanges{};  // same order as modNames
+		std::once_flag                                     initialized{};
+	};
+
+	// per-character mod and form selection over the shared FormCatalogue
+	template <class T>
+	class FormComboBoxFiltered
+	{
+	public:
+		FormComboBoxFiltered(std::string a_name) :
+			name(std::move(a_name))
+		{}
+
+		void InitForms()
+		{
+			FormCatalogue<T>::GetSingleton()->Init();
 			Reset();
 		}
 		void Reset()
 		{
-			curMod = allMods;
 			index = 0;
-			for (auto& [modName, formData] : modNameForms) {
-				formData.ResetIndex();
-				formData.SetValid(false);
-			}
+			ResetView();
 		}
 
-		void GetFormResultFromCombo(std::function<void(T*)> a_func, RE::Actor* a_actor = nullptr)
+		void GetFormResultFromCombo(std::invocable<T*> auto&& a_func, RE::Actor* a_actor = nullptr)
 		{
 			T* formResult;
 
@@ -240,20 +511,14 @@ namespace ImGui
 				ImGui::PushID(name.c_str());
 				ImGui::PushMultiItemsWidths(2, ImGui::GetContentRegionAvail().x);
 
-				if (ImGui::ComboWithFilter("##mods", &index, modNames)) {
-					if (index == 0) {
-						curMod = allMods;
-					} else if (containsFF && index == modNames.size() - 1) {
-						curMod = ffForms;
-					} else {
-						curMod = modNames[index];
-					}
+				if (ImGui::ComboWithFilter("##mods", &index, FormCatalogue<T>::GetSingleton()->GetModNames(), &modFilter)) {
+					ResetView();
 				}
 
 				ImGui::PopItemWidth();
 				ImGui::SameLine(0, ImGui::GetStyle().ItemInnerSpacing.x);
 
-				formResult = modNameForms[curMod].GetComboWithFilterResult(a_actor);
+				formResult = view.GetComboWithFilterResult(GetForms(), a_actor);
 
 				ImGui::PopItemWidth();
 				ImGui::PopID();
@@ -267,15 +532,25 @@ namespace ImGui
 		}
 
 	private:
+		FormSpan<T> GetForms() const
+		{
+			return FormCatalogue<T>::GetSingleton()->GetForms(index);
+		}
+		void ResetView()
+		{
+			std::int32_t formIndex = 0;
+			if constexpr (std::is_same_v<T, RE::TESWeather>) {
+				formIndex = std::max(FormCatalogue<T>::GetSingleton()->GetIndex(index, RE::Sky::GetSingleton()->currentWeather), 0);
+			}
+			view.Reset(formIndex);
+		}
+
 		// members
 		std::string name;
 		bool        translated{ false };
 
-		StringMap<FormComboBox<T>> modNameForms{};
-		std::vector<std::string>   modNames{};
-		std::int32_t               index{};
-		bool                       containsFF{ false };
-
-		std::string curMod{ allMods };
+		std::int32_t    index{};
+		ComboFilter     modFilter{};
+		FormListView<T> view{};
 	};
 }
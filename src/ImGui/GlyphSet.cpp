@@ -0,0 +1,55 @@
+#include "GlyphSet.h"
+
+namespace IconFont
+{
+	void GlyphSet::SetStatic(const ImFontGlyphRangesBuilder& a_builder)
+	{
+		staticGlyphs = a_builder;
+		// a codepoint 0 range would end the ranges before any glyph
+		staticGlyphs.UsedChars[0] &= ~1u;
+
+		for (int i = 0; i < glyphs.UsedChars.Size; ++i) {
+			glyphs.UsedChars[i] |= staticGlyphs.UsedChars[i];
+		}
+
+		hasStatic = true;
+	}
+
+	bool GlyphSet::Add(std::string_view a_text)
+	{
+		bool added = false;
+
+		auto       text = a_text.data();
+		const auto textEnd = text + a_text.size();
+		while (text < textEnd) {
+			unsigned int c = 0;
+			const auto   length = ImTextCharFromUtf8(&c, text, textEnd);
+			if (length == 0) {
+				break;
+			}
+			text += length;
+
+			// the first page is Latin-1, which is always baked, and control characters
+			if (c < pageSize || c > IM_UNICODE_CODEPOINT_MAX || glyphs.GetBit(c)) {
+				continue;
+			}
+
+			const auto first = (c / pageSize) * wordsPerPage;
+			std::fill_n(glyphs.UsedChars.Data + first, wordsPerPage, ~0u);
+			added = true;
+		}
+
+		return added;
+	}
+
+	bool GlyphSet::IsStatic() const
+	{
+		return std::equal(glyphs.UsedChars.begin(), glyphs.UsedChars.end(), staticGlyphs.UsedChars.begin());
+	}
+
+	void GlyphSet::BuildRanges(ImVector<ImWchar>& a_ranges)
+	{
+		a_ranges.clear();
+		glyphs.BuildRanges(&a_ranges);
+	}
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+namespace IconFont
+{
+	// Glyphs the fonts are baked with. The static set is known before the first build (translations, form names, Latin-1, icons),
+	// and is what the font atlas cache is keyed on. Names only known at runtime add the whole 256 codepoint page of each missing glyph,
+	// so one rebuild covers the rest of that script, e.g. every later Cyrillic or Latin Extended-A name
+	class GlyphSet
+	{
+	public:
+		// merged with the pages added so far
+		void SetStatic(const ImFontGlyphRangesBuilder& a_builder);
+		[[nodiscard]] bool HasStatic() const { return hasStatic; }
+
+		// true if a_text needs glyphs that weren't in the set
+		bool Add(std::string_view a_text);
+
+		// false once pages were added at runtime. Only the static set may be read from or written to the atlas cache
+		[[nodiscard]] bool IsStatic() const;
+
+		void BuildRanges(ImVector<ImWchar>& a_ranges);
+
+	private:
+		static constexpr std::uint32_t pageSize{ 256 };
+		static constexpr std::uint32_t wordsPerPage{ pageSize / 32 };
+
+		// members
+		ImFontGlyphRangesBuilder glyphs{};
+		ImFontGlyphRangesBuilder staticGlyphs{};
+		bool                     hasStatic{ false };
+	};
+}
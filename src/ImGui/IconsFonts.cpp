@@ -1,6 +1,5 @@
 #include "IconsFonts.h"
 
-#include "IconsFontAwesome6.h"
 #include "Input.h"
 #include "Renderer.h"
 #include "Util.h"
@@ -52,57 +51,332 @@ namespace IconFont
 		buttonScheme = static_cast<BUTTON_SCHEME>(a_ini.GetLongValue("Controls", "iButtonScheme", std::to_underlying(buttonScheme)));
 	}
 
-	void Manager::LoadIcons()
+	void Manager::UpdateIcons()
 	{
-		unknownKey.Load();
+		if (!iconAtlasTask.valid()) {
+			// first photo mode frame has been drawn with only the icons it needed, build the rest in the background
+			if (!prefetchedIcons) {
+				prefetchedIcons = true;
+				iconAtlasTask = std::async(std::launch::async, BuildIconAtlas, GetAllIcons());
+			}
+			return;
+		}
 
-		upKey.Load();
-		downKey.Load();
-		leftKey.Load();
-		rightKey.Load();
+		if (iconAtlasTask.wait_for(0s) == std::future_status::ready) {
+			if (const auto atlas = iconAtlasTask.get(); !atlas.rects.empty()) {
+				CreateIconAtlas(GetAllIcons(), atlas.rects, atlas.image);
+			}
+		}
+	}
 
-		std::for_each(keyboard.begin(), keyboard.end(), [](auto& IconData) {
-			IconData.second.Load();
-		});
-		std::for_each(gamePad.begin(), gamePad.end(), [](auto& IconData) {
-			auto& [xbox, ps4] = IconData.second;
-			xbox.Load();
-			ps4.Load();
-		});
-		std::for_each(mouse.begin(), mouse.end(), [](auto& IconData) {
-			IconData.second.Load();
+	const IconData* Manager::Resolve(IconData& a_icon)
+	{
+		if (!a_icon.requested) {
+			a_icon.requested = true;
+			a_icon.Load();
+		}
+		return &a_icon;
+	}
+
+	Manager::IconAtlas Manager::BuildIconAtlas(const std::vector<IconData*>& a_icons)
+	{
+		// runs on a std::async worker, which hasn't initialized COM for the WIC decoder. Pool threads are reused, so it's balanced per task
+		const auto comResult = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+		const auto key = GetIconAtlasKey(a_icons);
+
+		IconAtlas atlas;
+		if (LoadIconAtlasCache(key, a_icons.size(), atlas.rects, atlas.image)) {
+			logger::info("Loaded icon atlas from cache");
+		} else if (PackIconAtlas(a_icons, atlas.rects, atlas.image)) {
+			SaveIconAtlasCache(key, atlas.rects, atlas.image);
+		} else {
+			logger::error("Unable to build icon atlas");
+			atlas.rects.clear();
+		}
+
+		if (SUCCEEDED(comResult)) {
+			CoUninitialize();
+		}
+
+		return atlas;
+	}
+
+	std::vector<IconData*> Manager::GetAllIcons()
+	{
+		std::vector<IconData*> icons{ &unknownKey, &upKey, &downKey, &leftKey, &rightKey, &stepperLeft, &stepperRight, &checkbox, &checkboxFilled };
+		icons.reserve(icons.size() + keyboard.size() + (gamePad.size() * 2) + mouse.size());
+
+		for (auto& [key, icon] : keyboard) {
+			icons.push_back(&icon);
+		}
+		for (auto& [key, icon] : gamePad) {
+			icons.push_back(&icon.xbox);
+			icons.push_back(&icon.ps4);
+		}
+		for (auto& [key, icon] : mouse) {
+			icons.push_back(&icon);
+		}
+
+		return icons;
+	}
+
+	std::uint64_t Manager::GetIconAtlasKey(std::span<IconData* const> a_icons)
+	{
+		std::string key;
+		const auto  append = [&](const void* a_data, std::size_t a_size) {
+			key.append(static_cast<const char*>(a_data), a_size);
+		};
+
+		for (const auto icon : a_icons) {
+			std::error_code ec;
+			const auto      fileSize = std::filesystem::file_size(icon->path, ec);
+			const auto      writeTime = std::filesystem::last_write_time(icon->path, ec).time_since_epoch().count();
+
+			append(icon->path.data(), icon->path.size() * sizeof(wchar_t));
+			append(&fileSize, sizeof(fileSize));
+			append(&writeTime, sizeof(writeTime));
+		}
+
+		return Translation::HashKey(key);
+	}
+
+	bool Manager::LoadIconAtlasCache(std::uint64_t a_key, std::size_t a_count, std::vector<IconRect>& a_rects, DirectX::ScratchImage& a_atlas)
+	{
+		std::ifstream stream(iconAtlasCachePath, std::ios::binary);
+		if (!stream.good()) {
+			return false;
+		}
+
+		IconAtlasHeader header{};
+		if (!stream.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic != IconAtlasHeader::MAGIC || header.version != IconAtlasHeader::VERSION || header.key != a_key ||
+			header.count != a_count || header.width == 0 || header.height == 0) {
+			return false;
+		}
+
+		a_rects.resize(header.count);
+		if (!stream.read(reinterpret_cast<char*>(a_rects.data()), a_rects.size() * sizeof(IconRect))) {
+			return false;
+		}
+		if (!std::ranges::all_of(a_rects, [&](const IconRect& a_rect) { return a_rect.x + a_rect.width <= header.width && a_rect.y + a_rect.height <= header.height; })) {
+			return false;
+		}
+
+		if (FAILED(a_atlas.Initialize2D(DXGI_FORMAT_R8G8B8A8_UNORM, header.width, header.height, 1, 1))) {
+			return false;
+		}
+
+		return static_cast<bool>(stream.read(reinterpret_cast<char*>(a_atlas.GetPixels()), a_atlas.GetPixelsSize()));
+	}
+
+	void Manager::SaveIconAtlasCache(std::uint64_t a_key, std::span<const IconRect> a_rects, const DirectX::ScratchImage& a_atlas)
+	{
+		const std::filesystem::path path(iconAtlasCachePath);
+
+		std::error_code ec;
+		std::filesystem::create_directories(path.parent_path(), ec);
+
+		std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+		if (!stream.good()) {
+			logger::warn("Unable to write icon atlas cache {}", path.string());
+			return;
+		}
+
+		const auto&           metadata = a_atlas.GetMetadata();
+		const IconAtlasHeader header{ IconAtlasHeader::MAGIC, IconAtlasHeader::VERSION, a_key, static_cast<std::uint32_t>(a_rects.size()), static_cast<std::uint32_t>(metadata.width), static_cast<std::uint32_t>(metadata.height) };
+
+		stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		stream.write(reinterpret_cast<const char*>(a_rects.data()), a_rects.size() * sizeof(IconRect));
+		stream.write(reinterpret_cast<const char*>(a_atlas.GetPixels()), a_atlas.GetPixelsSize());
+	}
+
+	bool Manager::PackIconAtlas(std::span<IconData* const> a_icons, std::vector<IconRect>& a_rects, DirectX::ScratchImage& a_atlas)
+	{
+		std::vector<DirectX::ScratchImage> images(a_icons.size());
+
+		std::size_t area = 0;
+		std::size_t maxWidth = 0;
+
+		// one pixel between icons so filtering doesn't bleed into neighbours
+		constexpr std::size_t padding = 1;
+
+		for (std::size_t i = 0; i < a_icons.size(); ++i) {
+			DirectX::ScratchImage image;
+			if (FAILED(DirectX::LoadFromWICFile(a_icons[i]->path.c_str(), DirectX::WIC_FLAGS_IGNORE_SRGB, nullptr, image))) {
+				logger::warn("Unable to load icon {}", stl::utf16_to_utf8(a_icons[i]->path).value_or(""));
+				continue;
+			}
+			if (image.GetMetadata().format != DXGI_FORMAT_R8G8B8A8_UNORM) {
+				DirectX::ScratchImage converted;
+				if (FAILED(DirectX::Convert(*image.GetImage(0, 0, 0), DXGI_FORMAT_R8G8B8A8_UNORM, DirectX::TEX_FILTER_DEFAULT, DirectX::TEX_THRESHOLD_DEFAULT, converted))) {
+					continue;
+				}
+				image = std::move(converted);
+			}
+
+			const auto& metadata = image.GetMetadata();
+			area += (metadata.width + padding) * (metadata.height + padding);
+			maxWidth = std::max(maxWidth, metadata.width + padding);
+
+			images[i] = std::move(image);
+		}
+
+		if (area == 0) {
+			return false;
+		}
+
+		// shelf packing, tallest first
+		std::vector<std::size_t> order(images.size());
+		std::iota(order.begin(), order.end(), 0);
+		std::ranges::stable_sort(order, std::greater{}, [&](std::size_t a_index) {
+			return images[a_index].GetImageCount() ? images[a_index].GetMetadata().height : 0;
 		});
 
-		stepperLeft.Load();
-		stepperRight.Load();
-		checkbox.Load();
-		checkboxFilled.Load();
+		const auto width = std::max(std::bit_ceil(static_cast<std::size_t>(std::sqrt(static_cast<double>(area)))), maxWidth);
+
+		a_rects.assign(images.size(), {});
+
+		std::size_t x = 0;
+		std::size_t y = 0;
+		std::size_t shelfHeight = 0;
+		for (const auto index : order) {
+			if (!images[index].GetImageCount()) {
+				continue;
+			}
+			const auto& metadata = images[index].GetMetadata();
+			if (x + metadata.width > width) {
+				x = 0;
+				y += shelfHeight;
+				shelfHeight = 0;
+			}
+			a_rects[index] = { static_cast<std::uint16_t>(x), static_cast<std::uint16_t>(y), static_cast<std::uint16_t>(metadata.width), static_cast<std::uint16_t>(metadata.height) };
+			x += metadata.width + padding;
+			shelfHeight = std::max(shelfHeight, metadata.height + padding);
+		}
+
+		if (FAILED(a_atlas.Initialize2D(DXGI_FORMAT_R8G8B8A8_UNORM, width, y + shelfHeight, 1, 1))) {
+			return false;
+		}
+		std::memset(a_atlas.GetPixels(), 0, a_atlas.GetPixelsSize());
+
+		const auto dst = a_atlas.GetImage(0, 0, 0);
+		for (std::size_t i = 0; i < images.size(); ++i) {
+			if (!images[i].GetImageCount()) {
+				continue;
+			}
+			const auto  src = images[i].GetImage(0, 0, 0);
+			const auto& rect = a_rects[i];
+			for (std::size_t row = 0; row < rect.height; ++row) {
+				std::memcpy(dst->pixels + ((rect.y + row) * dst->rowPitch) + (rect.x * 4), src->pixels + (row * src->rowPitch), rect.width * 4);
+			}
+		}
+
+		logger::info("Packed {} icons into a {}x{} atlas", a_icons.size(), dst->width, dst->height);
+
+		return true;
 	}
 
-	void Manager::LoadFonts()
+	void Manager::CreateIconAtlas(std::span<IconData* const> a_icons, std::span<const IconRect> a_rects, const DirectX::ScratchImage& a_atlas)
 	{
-		if (loadedFonts) {
+		const auto renderer = RE::BSGraphics::Renderer::GetSingleton();
+
+		ComPtr<ID3D11ShaderResourceView> srView;
+		if (FAILED(DirectX::CreateShaderResourceView(renderer->data.forwarder, a_atlas.GetImages(), 1, a_atlas.GetMetadata(), &srView))) {
+			logger::error("Unable to create icon atlas texture");
 			return;
 		}
 
-		loadedFonts = true;
+		// 0.0004630f is 0.5/1080
+		// at 1080 render at half size
+		const auto scale = 0.0004630f * renderer->data.renderWindows[0].windowHeight;
 
-		ImVector<ImWchar>        ranges;
-		ImFontGlyphRangesBuilder builder;
-		builder.AddText(RE::BSScaleformManager::GetSingleton()->validNameChars.c_str());
-		builder.AddChar(0xf030);  // CAMERA
-		builder.AddChar(0xf017);  // CLOCK
-		builder.AddChar(0xf183);  // PERSON
-		builder.AddChar(0xf042);  // CONTRAST
-		builder.AddChar(0xf03e);  // IMAGE
-		builder.BuildRanges(&ranges);
+		const auto& metadata = a_atlas.GetMetadata();
+		const auto  atlasSize = ImVec2(static_cast<float>(metadata.width), static_cast<float>(metadata.height));
+
+		for (std::size_t i = 0; i < a_icons.size(); ++i) {
+			const auto& rect = a_rects[i];
+			if (rect.width == 0) {
+				continue;
+			}
+
+			const auto icon = a_icons[i];
+			const auto min = ImVec2(rect.x, rect.y);
+			const auto max = ImVec2(rect.x + rect.width, rect.y + rect.height);
+
+			icon->srView = srView;
+			icon->requested = true;
+			icon->uv0 = min / atlasSize;
+			icon->uv1 = max / atlasSize;
+			icon->size = (max - min) * scale;
+		}
+	}
+
+	void Manager::BuildGlyphRanges(ImFontGlyphRangesBuilder& a_builder)
+	{
+		// Basic Latin + Latin-1 Supplement, for text typed into filters and names added at runtime
+		static constexpr std::array<ImWchar, 3> latinRange{ 0x0020, 0x00FF, 0 };
+		a_builder.AddRanges(latinRange.data());
+
+		a_builder.AddChar(0xf030);  // CAMERA
+		a_builder.AddChar(0xf017);  // CLOCK
+		a_builder.AddChar(0xf183);  // PERSON
+		a_builder.AddChar(0xf042);  // CONTRAST
+		a_builder.AddChar(0xf03e);  // IMAGE
+
+		// merged, since names added with AddGlyphs may already be in glyphs
+		glyphs.SetStatic(a_builder);
+	}
+
+	void Manager::AddGlyphs(std::string_view a_text)
+	{
+		if (glyphs.Add(a_text)) {
+			missingGlyphs = loadedFonts;
+		}
+	}
+
+	void Manager::LoadFonts()
+	{
+		if (loadedFonts && !missingGlyphs) {
+			return;
+		}
+
+		if (!glyphs.HasStatic()) {
+			ImFontGlyphRangesBuilder builder;
+			builder.AddText(RE::BSScaleformManager::GetSingleton()->validNameChars.c_str());
+			BuildGlyphRanges(builder);
+		}
 
 		auto& io = ImGui::GetIO();
 
+		if (loadedFonts) {
+			// a name shown since the fonts were baked needs glyphs that aren't in them. ImGui_ImplDX11_NewFrame recreates the font texture
+			logger::info("Rebuilding fonts with new glyphs");
+			io.Fonts->Clear();
+			ImGui_ImplDX11_InvalidateDeviceObjects();
+		}
+
+		loadedFonts = true;
+		missingGlyphs = false;
+
+		glyphs.BuildRanges(ranges);
+
 		io.FontDefault = LoadFontIconSet(fontSize, iconSize, ranges);
 		largeFont = LoadFontIconSet(largeFontSize, largeIconSize, ranges);
 
+		// the cache only holds the static glyphs, so that runtime names don't replace it every session
+		if (!glyphs.IsStatic()) {
+			io.Fonts->Build();
+			return;
+		}
+
+		const auto key = GetAtlasKey();
+		if (LoadAtlasCache(key)) {
+			logger::info("Loaded font atlas from cache");
+			return;
+		}
+
 		io.Fonts->Build();
+		SaveAtlasCache(key);
 	}
 
 	ImFont* Manager::LoadFontIconSet(float a_fontSize, float a_iconSize, const ImVector<ImWchar>& a_ranges) const
@@ -116,32 +390,197 @@ namespace IconFont
 		icon_config.PixelSnapH = true;
 		icon_config.OversampleH = icon_config.OversampleV = 1;
 
-		io.Fonts->AddFontFromFileTTF(R"(Data\Interface\PhotoMode\Fonts\)" FONT_ICON_FILE_NAME_FAS, a_iconSize, &icon_config, a_ranges.Data);
+		io.Fonts->AddFontFromFileTTF(iconFontName, a_iconSize, &icon_config, a_ranges.Data);
 
 		return font;
 	}
 
+	std::uint64_t Manager::GetAtlasKey() const
+	{
+		const auto hash_bytes = [](std::span<const std::byte> a_bytes) {
+			return Translation::HashKey({ reinterpret_cast<const char*>(a_bytes.data()), a_bytes.size() });
+		};
+
+		const Translation::MappedFile font(fontName);
+		const Translation::MappedFile iconFont(iconFontName);
+
+		const std::array<std::uint64_t, 8> key{
+			hash_bytes(font.GetBytes()),
+			hash_bytes(iconFont.GetBytes()),
+			hash_bytes(std::as_bytes(std::span(ranges.Data, ranges.Size))),
+			std::bit_cast<std::uint32_t>(fontSize),
+			std::bit_cast<std::uint32_t>(iconSize),
+			std::bit_cast<std::uint32_t>(largeFontSize),
+			std::bit_cast<std::uint32_t>(largeIconSize),
+			IMGUI_VERSION_NUM
+		};
+
+		return hash_bytes(std::as_bytes(std::span(key)));
+	}
+
+	bool Manager::LoadAtlasCache(std::uint64_t a_key) const
+	{
+		std::ifstream stream(atlasCachePath, std::ios::binary);
+		if (!stream.good()) {
+			return false;
+		}
+
+		const auto atlas = ImGui::GetIO().Fonts;
+
+		AtlasCacheHeader header{};
+		if (!stream.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic != AtlasCacheHeader::MAGIC || header.version != AtlasCacheHeader::VERSION || header.key != a_key ||
+			header.fontCount != static_cast<std::uint32_t>(atlas->Fonts.Size) || header.texWidth <= 0 || header.texHeight <= 0 || header.texWidth > 16384 || header.texHeight > 16384) {
+			return false;
+		}
+
+		// registers the mouse cursor and baked line rects like Build does, their positions come from the cache
+		ImFontAtlasBuildInit(atlas);
+		if (header.customRectCount != static_cast<std::uint32_t>(atlas->CustomRects.Size)) {
+			return false;
+		}
+		std::vector<AtlasCacheRect> customRects(header.customRectCount);
+		if (!stream.read(reinterpret_cast<char*>(customRects.data()), customRects.size() * sizeof(AtlasCacheRect))) {
+			return false;
+		}
+		for (int i = 0; i < atlas->CustomRects.Size; ++i) {
+			const auto& rect = customRects[i];
+			if (rect.width != atlas->CustomRects[i].Width || rect.height != atlas->CustomRects[i].Height || rect.x + rect.width > header.texWidth || rect.y + rect.height > header.texHeight) {
+				return false;
+			}
+		}
+
+		ImVec2                                                  whitePixel;
+		std::array<ImVec4, IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1> lineUVs;
+		if (!stream.read(reinterpret_cast<char*>(&whitePixel), sizeof(whitePixel)) || !stream.read(reinterpret_cast<char*>(lineUVs.data()), sizeof(lineUVs))) {
+			return false;
+		}
+
+		std::vector<std::pair<AtlasCacheFont, std::vector<ImFontGlyph>>> fonts(header.fontCount);
+		for (auto& [metrics, glyphs] : fonts) {
+			if (!stream.read(reinterpret_cast<char*>(&metrics), sizeof(metrics))) {
+				return false;
+			}
+			if (metrics.glyphCount == 0 || metrics.glyphCount > IM_UNICODE_CODEPOINT_MAX + 1) {
+				return false;
+			}
+			glyphs.resize(metrics.glyphCount);
+			if (!stream.read(reinterpret_cast<char*>(glyphs.data()), glyphs.size() * sizeof(ImFontGlyph))) {
+				return false;
+			}
+		}
+
+		const auto pixelCount = static_cast<std::size_t>(header.texWidth) * header.texHeight;
+		const auto pixels = static_cast<unsigned char*>(IM_ALLOC(pixelCount));
+		if (!stream.read(reinterpret_cast<char*>(pixels), pixelCount)) {
+			IM_FREE(pixels);
+			return false;
+		}
+
+		// same end state as ImFontAtlas::Build, without rasterizing
+		atlas->ClearTexData();
+		atlas->TexPixelsAlpha8 = pixels;
+		atlas->TexWidth = header.texWidth;
+		atlas->TexHeight = header.texHeight;
+		atlas->TexUvScale = ImVec2(1.0f / header.texWidth, 1.0f / header.texHeight);
+		atlas->TexUvWhitePixel = whitePixel;
+		std::ranges::copy(lineUVs, atlas->TexUvLines);
+
+		for (int i = 0; i < atlas->CustomRects.Size; ++i) {
+			atlas->CustomRects[i].X = customRects[i].x;
+			atlas->CustomRects[i].Y = customRects[i].y;
+		}
+
+		for (std::uint32_t i = 0; i < header.fontCount; ++i) {
+			const auto& [metrics, glyphs] = fonts[i];
+
+			const auto font = atlas->Fonts[i];
+			font->ClearOutputData();
+			font->ContainerAtlas = atlas;
+			font->FontSize = metrics.fontSize;
+			font->Ascent = metrics.ascent;
+			font->Descent = metrics.descent;
+
+			// same config links as ImFontAtlasBuildSetupFont
+			font->ConfigDataCount = 0;
+			for (auto& config : atlas->ConfigData) {
+				if (config.DstFont == font) {
+					if (!config.MergeMode) {
+						font->ConfigData = &config;
+					}
+					font->ConfigDataCount++;
+				}
+			}
+
+			font->Glyphs.resize(static_cast<int>(glyphs.size()));
+			std::ranges::copy(glyphs, font->Glyphs.Data);
+			font->BuildLookupTable();
+		}
+
+		atlas->TexReady = true;
+
+		return true;
+	}
+
+	void Manager::SaveAtlasCache(std::uint64_t a_key) const
+	{
+		const auto atlas = ImGui::GetIO().Fonts;
+		if (!atlas->TexPixelsAlpha8) {
+			return;
+		}
+
+		const std::filesystem::path path(atlasCachePath);
+
+		std::error_code ec;
+		std::filesystem::create_directories(path.parent_path(), ec);
+
+		std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+		if (!stream.good()) {
+			logger::warn("Unable to write font atlas cache {}", path.string());
+			return;
+		}
+
+		const AtlasCacheHeader header{ AtlasCacheHeader::MAGIC, AtlasCacheHeader::VERSION, a_key, static_cast<std::uint32_t>(atlas->Fonts.Size), atlas->TexWidth, atlas->TexHeight, static_cast<std::uint32_t>(atlas->CustomRects.Size) };
+
+		stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		for (const auto& rect : atlas->CustomRects) {
+			const AtlasCacheRect cacheRect{ rect.X, rect.Y, rect.Width, rect.Height };
+			stream.write(reinterpret_cast<const char*>(&cacheRect), sizeof(cacheRect));
+		}
+		stream.write(reinterpret_cast<const char*>(&atlas->TexUvWhitePixel), sizeof(ImVec2));
+		stream.write(reinterpret_cast<const char*>(atlas->TexUvLines), sizeof(ImVec4) * (IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1));
+
+		for (const auto font : atlas->Fonts) {
+			const AtlasCacheFont metrics{ font->FontSize, font->Ascent, font->Descent, static_cast<std::uint32_t>(font->Glyphs.Size) };
+			stream.write(reinterpret_cast<const char*>(&metrics), sizeof(metrics));
+			stream.write(reinterpret_cast<const char*>(font->Glyphs.Data), font->Glyphs.Size * sizeof(ImFontGlyph));
+		}
+
+		stream.write(reinterpret_cast<const char*>(atlas->TexPixelsAlpha8), static_cast<std::streamsize>(atlas->TexWidth) * atlas->TexHeight);
+
+		logger::info("Baked {} glyph ranges into a {}x{} font atlas", ranges.Size / 2, atlas->TexWidth, atlas->TexHeight);
+	}
+
 	ImFont* Manager::GetLargeFont() const
 	{
 		return largeFont;
 	}
 
-	const IconData* Manager::GetStepperLeft() const
+	const IconData* Manager::GetStepperLeft()
 	{
-		return &stepperLeft;
+		return Resolve(stepperLeft);
 	}
-	const IconData* Manager::GetStepperRight() const
+	const IconData* Manager::GetStepperRight()
 	{
-		return &stepperRight;
+		return Resolve(stepperRight);
 	}
 
-	const IconData* Manager::GetCheckbox() const
+	const IconData* Manager::GetCheckbox()
 	{
-		return &checkbox;
+		return Resolve(checkbox);
 	}
-	const IconData* Manager::GetCheckboxFilled() const
+	const IconData* Manager::GetCheckboxFilled()
 	{
-		return &checkboxFilled;
+		return Resolve(checkboxFilled);
 	}
 
 	const IconData* Manager::GetIcon(std::uint32_t key)
@@ -149,60 +588,67 @@ namespace IconFont
 		switch (key) {
 		case KEY::kUp:
 		case SKSE::InputMap::kGamepadButtonOffset_DPAD_UP:
-			return &upKey;
+			return Resolve(upKey);
 		case KEY::kDown:
 		case SKSE::InputMap::kGamepadButtonOffset_DPAD_DOWN:
-			return &downKey;
+			return Resolve(downKey);
 		case KEY::kLeft:
 		case SKSE::InputMap::kGamepadButtonOffset_DPAD_LEFT:
-			return &leftKey;
+			return Resolve(leftKey);
 		case KEY::kRight:
 		case SKSE::InputMap::kGamepadButtonOffset_DPAD_RIGHT:
-			return &rightKey;
+			return Resolve(rightKey);
 		default:
 			{
 				if (Input::GetInputType() == Input::TYPE::kKeyboard) {
 					if (key >= SKSE::InputMap::kMacro_MouseButtonOffset) {
 						if (const auto it = mouse.find(key); it != mouse.end()) {
-							return &it->second;
+							return Resolve(it->second);
 						}
 					} else if (const auto it = keyboard.find(static_cast<KEY>(key)); it != keyboard.end()) {
-						return &it->second;
+						return Resolve(it->second);
 					}
 				} else {
 					if (const auto it = gamePad.find(key); it != gamePad.end()) {
 						return GetGamePadIcon(it->second);
 					}
 				}
-				return &unknownKey;
+				return Resolve(unknownKey);
 			}
 		}
 	}
 
-	std::set<const IconData*> Manager::GetIcons(const std::set<std::uint32_t>& keys)
+	FrameVector<const IconData*> Manager::GetIcons(std::span<const std::uint32_t> keys)
 	{
-		std::set<const IconData*> icons{};
+		FrameVector<const IconData*> icons{ FrameAllocator() };
 		if (keys.empty()) {
-			icons.insert(&unknownKey);
+			icons.push_back(Resolve(unknownKey));
 		} else {
 			for (auto& key : keys) {
-				icons.insert(GetIcon(key));
+				if (const auto icon = GetIcon(key); std::ranges::find(icons, icon) == icons.end()) {
+					icons.push_back(icon);
+				}
 			}
 		}
 		return icons;
 	}
 
-	const IconData* Manager::GetGamePadIcon(const GamepadIcon& a_icons) const
+	Manager::BUTTON_SCHEME Manager::GetButtonScheme() const
+	{
+		return buttonScheme;
+	}
+
+	const IconData* Manager::GetGamePadIcon(GamepadIcon& a_icons)
 	{
 		switch (buttonScheme) {
 		case BUTTON_SCHEME::kAutoDetect:
-			return Input::GetInputType() == Input::TYPE::kGamepadOrbis ? &a_icons.ps4 : &a_icons.xbox;
+			return Resolve(Input::GetInputType() == Input::TYPE::kGamepadOrbis ? a_icons.ps4 : a_icons.xbox);
 		case BUTTON_SCHEME::kXbox:
-			return &a_icons.xbox;
+			return Resolve(a_icons.xbox);
 		case BUTTON_SCHEME::kPS4:
-			return &a_icons.ps4;
+			return Resolve(a_icons.ps4);
 		default:
-			return &a_icons.xbox;
+			return Resolve(a_icons.xbox);
 		}
 	}
 }
@@ -219,12 +665,12 @@ ImVec2 ImGui::ButtonIcon(const IconFont::IconData* a_IconData, bool a_centerIcon
 		const float height = ImGui::GetWindowSize().y;
 		ImGui::SetCursorPosY((height - a_IconData->size.y) / 2);
 	}
-	ImGui::Image(a_IconData->srView.Get(), a_IconData->size);
+	ImGui::Image(a_IconData->srView.Get(), a_IconData->size, a_IconData->uv0, a_IconData->uv1);
 
 	return a_IconData->size;
 }
 
-void ImGui::ButtonIcon(const std::set<const IconFont::IconData*>& a_IconData, bool a_centerIcon)
+void ImGui::ButtonIcon(std::span<const IconFont::IconData* const> a_IconData, bool a_centerIcon)
 {
 	BeginGroup();
 	for (auto& IconData : a_IconData) {
@@ -242,7 +688,7 @@ void ImGui::ButtonIconWithLabel(const char* a_text, const IconFont::IconData* a_
 	ImGui::CenteredText(a_text, true);
 }
 
-void ImGui::ButtonIconWithLabel(const char* a_text, const std::set<const IconFont::IconData*>& a_IconData, bool a_centerIcon)
+void ImGui::ButtonIconWithLabel(const char* a_text, std::span<const IconFont::IconData* const> a_IconData, bool a_centerIcon)
 {
 	ImGui::ButtonIcon(a_IconData, a_centerIcon);
 	ImGui::SameLine();
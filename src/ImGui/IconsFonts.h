@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Graphics.h"
+#include "GlyphSet.h"
+#include "IconsFontAwesome6.h"
 
 namespace IconFont
 {
@@ -12,6 +14,11 @@ namespace IconFont
 		~IconData() override = default;
 
 		bool Load(bool a_resizeToScreenRes = false) override;
+
+		// members
+		ImVec2 uv0{ 0.0f, 0.0f };  // region of the icon atlas, srView is shared by every icon
+		ImVec2 uv1{ 1.0f, 1.0f };
+		bool   requested{ false };  // loaded on its own, or placed in the atlas
 	};
 
 	class Manager final : public ISingleton<Manager>
@@ -23,36 +30,131 @@ namespace IconFont
 			IconData ps4;
 		};
 
+		enum class BUTTON_SCHEME
+		{
+			kAutoDetect,
+			kXbox,
+			kPS4
+		};
+
 		void LoadSettings(CSimpleIniA& a_ini);
 		void LoadMCMSettings(const CSimpleIniA& a_ini);
 
-		void LoadIcons();
+		// icons are loaded individually on first use. After the first photo mode frame, the atlas is built in the background and replaces them
+		void UpdateIcons();
 		void LoadFonts();
 
+		// fonts are baked with only the glyphs in a_builder (plus Latin-1 and icons). Falls back to validNameChars if never called
+		void BuildGlyphRanges(ImFontGlyphRangesBuilder& a_builder);
+		// names only known at runtime (renamed items, actors). The fonts are rebuilt before the next frame if any glyph is missing,
+		// with the rest of its script, and without the atlas cache
+		void AddGlyphs(std::string_view a_text);
+
 		ImFont* GetLargeFont() const;
 
-		const IconData* GetStepperLeft() const;
-		const IconData* GetStepperRight() const;
-		const IconData* GetCheckbox() const;
-		const IconData* GetCheckboxFilled() const;
+		const IconData* GetStepperLeft();
+		const IconData* GetStepperRight();
+		const IconData* GetCheckbox();
+		const IconData* GetCheckboxFilled();
 
-		const IconData*           GetIcon(std::uint32_t key);
-		std::set<const IconData*> GetIcons(const std::set<std::uint32_t>& keys);
+		const IconData*              GetIcon(std::uint32_t key);
+		FrameVector<const IconData*> GetIcons(std::span<const std::uint32_t> keys);
 
-		const IconData* GetGamePadIcon(const GamepadIcon& a_icons) const;
+		const IconData* GetGamePadIcon(GamepadIcon& a_icons);
+		BUTTON_SCHEME   GetButtonScheme() const;
 
 	private:
-		enum class BUTTON_SCHEME
+		// baked atlas is cached as a header, custom rects (mouse cursors, lines), white pixel/line UVs, per font metrics and glyphs, then the alpha8 pixels
+		struct AtlasCacheHeader
 		{
-			kAutoDetect,
-			kXbox,
-			kPS4
+			static constexpr std::uint32_t MAGIC = 0x41464D50;  // PMFA
+			static constexpr std::uint32_t VERSION = 2;
+
+			// members
+			std::uint32_t magic;
+			std::uint32_t version;
+			std::uint64_t key;  // font files, sizes, glyph ranges and imgui version
+			std::uint32_t fontCount;
+			std::int32_t  texWidth;
+			std::int32_t  texHeight;
+			std::uint32_t customRectCount;
+		};
+		struct AtlasCacheRect
+		{
+			// members
+			std::uint16_t x;
+			std::uint16_t y;
+			std::uint16_t width;
+			std::uint16_t height;
+		};
+		struct AtlasCacheFont
+		{
+			// members
+			float         fontSize;
+			float         ascent;
+			float         descent;
+			std::uint32_t glyphCount;
+		};
+
+		// icons are packed into one texture so they batch into a single draw call.
+		// The packed pixels are cached as a header, a rect per icon, then the RGBA pixels
+		struct IconAtlasHeader
+		{
+			static constexpr std::uint32_t MAGIC = 0x41494D50;  // PMIA
+			static constexpr std::uint32_t VERSION = 1;
+
+			// members
+			std::uint32_t magic;
+			std::uint32_t version;
+			std::uint64_t key;  // path, size and write time of every icon
+			std::uint32_t count;
+			std::uint32_t width;
+			std::uint32_t height;
+		};
+		struct IconRect
+		{
+			// members
+			std::uint16_t x;
+			std::uint16_t y;
+			std::uint16_t width;
+			std::uint16_t height;
+		};
+
+		struct IconAtlas
+		{
+			// members
+			std::vector<IconRect> rects;  // empty if the atlas couldn't be built
+			DirectX::ScratchImage image;
 		};
 
 		ImFont* LoadFontIconSet(float a_fontSize, float a_iconSize, const ImVector<ImWchar>& a_ranges) const;
 
+		static const IconData* Resolve(IconData& a_icon);
+
+		std::vector<IconData*> GetAllIcons();
+		static IconAtlas       BuildIconAtlas(const std::vector<IconData*>& a_icons);
+		static std::uint64_t   GetIconAtlasKey(std::span<IconData* const> a_icons);
+		static bool            LoadIconAtlasCache(std::uint64_t a_key, std::size_t a_count, std::vector<IconRect>& a_rects, DirectX::ScratchImage& a_atlas);
+		static void            SaveIconAtlasCache(std::uint64_t a_key, std::span<const IconRect> a_rects, const DirectX::ScratchImage& a_atlas);
+		static bool            PackIconAtlas(std::span<IconData* const> a_icons, std::vector<IconRect>& a_rects, DirectX::ScratchImage& a_atlas);
+		static void            CreateIconAtlas(std::span<IconData* const> a_icons, std::span<const IconRect> a_rects, const DirectX::ScratchImage& a_atlas);
+
+		std::uint64_t GetAtlasKey() const;
+		bool          LoadAtlasCache(std::uint64_t a_key) const;
+		void          SaveAtlasCache(std::uint64_t a_key) const;
+
+		static constexpr auto iconFontName{ R"(Data\Interface\PhotoMode\Fonts\)" FONT_ICON_FILE_NAME_FAS };
+		static constexpr auto iconAtlasCachePath{ R"(Data\SKSE\Plugins\PhotoMode\Cache\IconAtlas.bin)" };
+		static constexpr auto atlasCachePath{ R"(Data\SKSE\Plugins\PhotoMode\Cache\FontAtlas.bin)" };
+
 		// members
-		bool loadedFonts{ false };
+		bool              loadedFonts{ false };
+		GlyphSet          glyphs{};
+		bool              missingGlyphs{ false };  // added since the fonts were baked
+		ImVector<ImWchar> ranges{};
+
+		std::future<IconAtlas> iconAtlasTask{};
+		bool                   prefetchedIcons{ false };
 
 		std::string fontName{ "Jost-Regular.ttf" };
 		float       fontSize{ 26 };
@@ -211,8 +313,8 @@ namespace ImGui
 	ImVec2 ButtonIcon(std::uint32_t a_key);
 
 	ImVec2 ButtonIcon(const IconFont::IconData* a_IconData, bool a_centerIcon);
-	void   ButtonIcon(const std::set<const IconFont::IconData*>& a_IconData, bool a_centerIcon);
+	void   ButtonIcon(std::span<const IconFont::IconData* const> a_IconData, bool a_centerIcon);
 
 	void ButtonIconWithLabel(const char* a_text, const IconFont::IconData* a_IconData, bool a_centerIcon);
-	void ButtonIconWithLabel(const char* a_text, const std::set<const IconFont::IconData*>& a_IconData, bool a_centerIcon);
+	void ButtonIconWithLabel(const char* a_text, std::span<const IconFont::IconData* const> a_IconData, bool a_centerIcon);
 }
@@ -0,0 +1,57 @@
+#include "IdleValidity.h"
+
+#include "FormComboBox.h"
+
+namespace ImGui
+{
+	std::uint64_t IdleValidity::GetKey(RE::Actor* a_actor)
+	{
+		// idle conditions can test anything about the subject (faction, keywords, actor values, quest aliases...),
+		// so results are only shared by the same actor
+		return static_cast<std::uint64_t>(a_actor->GetFormID()) |
+		       static_cast<std::uint64_t>(a_actor->IsWeaponDrawn()) << 32;
+	}
+
+	const IdleValidity::Entry& IdleValidity::Update(RE::Actor* a_actor)
+	{
+		auto& entry = entries[GetKey(a_actor)];
+		if (entry.complete) {
+			return entry;
+		}
+
+		// the budget is shared by every combo box drawn this frame
+		if (frame != GetFrameCount()) {
+			frame = GetFrameCount();
+			frameStart = std::chrono::steady_clock::now();
+		}
+
+		const auto idles = FormCatalogue<RE::TESIdleForm>::GetSingleton()->GetForms(0).forms;
+		const auto count = static_cast<std::int32_t>(idles.size());
+
+		while (entry.next < count && std::chrono::steady_clock::now() - frameStart < frameBudget) {
+			for (const auto end = std::min(entry.next + batchSize, count); entry.next < end; ++entry.next) {
+				const auto idle = idles[entry.next];
+				if (a_actor->CanUseIdle(idle) && idle->CheckConditions(a_actor, nullptr, false)) {
+					entry.indices.push_back(entry.next);
+				}
+			}
+		}
+		entry.complete = entry.next == count;
+
+		return entry;
+	}
+
+	bool IdleValidity::IsValid(RE::Actor* a_actor, RE::TESIdleForm* a_idle) const
+	{
+		const auto index = FormCatalogue<RE::TESIdleForm>::GetSingleton()->GetIndex(0, a_idle);
+		if (const auto it = entries.find(GetKey(a_actor)); it != entries.end() && index >= 0 && index < it->second.next) {
+			return std::ranges::binary_search(it->second.indices, index);
+		}
+		return a_actor->CanUseIdle(a_idle) && a_idle->CheckConditions(a_actor, nullptr, false);
+	}
+
+	void IdleValidity::Clear()
+	{
+		entries.clear();
+	}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+namespace ImGui
+{
+	// Idles in the idle catalogue that an actor can play. CanUseIdle/CheckConditions are run on a few idles per frame within a time budget,
+	// and the results are kept per actor and weapon state until Photo Mode is reopened
+	class IdleValidity : public ISingleton<IdleValidity>
+	{
+	public:
+		struct Entry
+		{
+			// members
+			std::vector<std::int32_t> indices{};  // ascending indices into the idle catalogue
+			std::int32_t              next{ 0 };
+			bool                      complete{ false };
+		};
+
+		const Entry& Update(RE::Actor* a_actor);
+		void         Clear();
+
+		// uses the actor's entry if it has already reached the idle, and checks the conditions otherwise
+		bool IsValid(RE::Actor* a_actor, RE::TESIdleForm* a_idle) const;
+
+	private:
+		static std::uint64_t GetKey(RE::Actor* a_actor);
+
+		static constexpr auto frameBudget = std::chrono::milliseconds(2);
+		static constexpr auto batchSize = 16;
+
+		// members
+		Map<std::uint64_t, Entry>             entries{};
+		int                                   frame{ -1 };
+		std::chrono::steady_clock::time_point frameStart{};
+	};
+}
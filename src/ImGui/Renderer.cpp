@@ -2,6 +2,7 @@
 #include "IconsFonts.h"
 #include "Styles.h"
 
+#include "InputRecorder.h"
 #include "PhotoMode/Manager.h"
 
 namespace ImGui::Renderer
@@ -62,8 +63,6 @@ namespace ImGui::Renderer
 					return;
 				}
 
-				MANAGER(IconFont)->LoadIcons();
-
 				logger::info("ImGui initialized.");
 
 				initialized.store(true);
@@ -101,6 +100,11 @@ namespace ImGui::Renderer
 
 			MANAGER(IconFont)->LoadFonts();
 
+			const auto recorder = MANAGER(InputRecorder);
+			recorder->BeginFrame();
+
+			const auto frameStart = std::chrono::steady_clock::now();
+
 			ImGui_ImplDX11_NewFrame();
 			ImGui_ImplWin32_NewFrame();
 			ImGui::NewFrame();
@@ -113,6 +117,12 @@ namespace ImGui::Renderer
 			ImGui::EndFrame();
 			ImGui::Render();
 			ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+
+			recorder->EndFrame(std::chrono::steady_clock::now() - frameStart);
+
+			MANAGER(IconFont)->UpdateIcons();
+
+			FrameArena::GetSingleton()->Reset();
 		}
 		static inline REL::Relocation<decltype(thunk)> func;
 	};
@@ -0,0 +1,171 @@
+#include "SearchIndex.h"
+
+namespace ImGui
+{
+	// partial_token_ratio(pattern, item) is 100 if they share a token. Otherwise it's partial_ratio between the sorted tokens joined by spaces
+	// (and between the unique ones, if any token repeats), which looks for the shorter string s, of length m, in the longer one.
+	// The best window w scores 200 * lcs / (m + |w|), and as |w| >= lcs that is at most 200 * I / (m + I),
+	// where I is the number of pattern characters (spaces included) that occur in the item at all.
+
+	std::uint32_t SearchIndex::GetBucket(char a_char)
+	{
+		// partial_token_ratio is case sensitive. Other characters, including every byte of multi-byte UTF-8, share the last bucket
+		if (a_char >= 'a' && a_char <= 'z') {
+			return a_char - 'a';
+		}
+		if (a_char >= 'A' && a_char <= 'Z') {
+			return 26 + (a_char - 'A');
+		}
+		if (a_char >= '0' && a_char <= '9') {
+			return 52 + (a_char - '0');
+		}
+		return a_char == ' ' ? 62 : 63;
+	}
+
+	template <class F>
+	void SearchIndex::ForEachToken(std::string_view a_str, F&& a_func)
+	{
+		// same separators as rapidfuzz for char strings
+		const auto is_space = [](char a_char) {
+			return (a_char >= 0x09 && a_char <= 0x0D) || (a_char >= 0x1C && a_char <= 0x20);
+		};
+
+		std::size_t tokenStart = 0;
+		for (std::size_t i = 0; i <= a_str.size(); ++i) {
+			if (i == a_str.size() || is_space(a_str[i])) {
+				if (i > tokenStart) {
+					a_func(a_str.substr(tokenStart, i - tokenStart));
+				}
+				tokenStart = i + 1;
+			}
+		}
+	}
+
+	void SearchIndex::Build(std::span<const std::string_view> a_items)
+	{
+		Clear();
+
+		items.reserve(a_items.size());
+
+		std::vector<std::string_view> itemTokens;
+		for (std::int32_t i = 0; i < static_cast<std::int32_t>(a_items.size()); ++i) {
+			itemTokens.clear();
+			ForEachToken(a_items[i], [&](std::string_view a_token) {
+				itemTokens.push_back(a_token);
+			});
+
+			Item item{ 0, 0 };
+			if (itemTokens.size() > 1) {
+				item.characters |= std::uint64_t(1) << GetBucket(' ');
+			}
+
+			std::ranges::sort(itemTokens);
+			const auto [first, last] = std::ranges::unique(itemTokens);
+			itemTokens.erase(first, last);
+
+			for (const auto& token : itemTokens) {
+				for (const auto& ch : token) {
+					item.characters |= std::uint64_t(1) << GetBucket(ch);
+				}
+				item.length += static_cast<std::uint32_t>(token.size()) + 1;
+				tokens.emplace_back(std::hash<std::string_view>{}(token), i);
+			}
+			if (item.length > 0) {
+				--item.length;
+			}
+
+			items.push_back(item);
+		}
+
+		std::ranges::sort(tokens);
+
+		built = true;
+	}
+
+	void SearchIndex::Clear()
+	{
+		items.clear();
+		tokens.clear();
+		built = false;
+	}
+
+	bool SearchIndex::IsBuilt() const
+	{
+		return built;
+	}
+
+	bool SearchIndex::GetCandidates(std::string_view a_pattern, double a_scoreCutoff, std::int32_t a_first, std::int32_t a_count, std::vector<std::int32_t>& a_candidates) const
+	{
+		a_candidates.clear();
+
+		std::array<std::uint32_t, 64> counts{};
+		std::vector<std::string_view> patternTokens;
+		ForEachToken(a_pattern, [&](std::string_view a_token) {
+			for (const auto& ch : a_token) {
+				++counts[GetBucket(ch)];
+			}
+			patternTokens.push_back(a_token);
+		});
+		if (patternTokens.empty()) {
+			return false;
+		}
+		counts[GetBucket(' ')] += static_cast<std::uint32_t>(patternTokens.size() - 1);
+
+		std::uint64_t patternCharacters = 0;
+		for (std::uint32_t bucket = 0; bucket < counts.size(); ++bucket) {
+			if (counts[bucket] > 0) {
+				patternCharacters |= std::uint64_t(1) << bucket;
+			}
+		}
+
+		std::ranges::sort(patternTokens);
+		const auto [first, last] = std::ranges::unique(patternTokens);
+		patternTokens.erase(first, last);
+
+		std::uint32_t patternLength = 0;
+		for (const auto& token : patternTokens) {
+			patternLength += static_cast<std::uint32_t>(token.size()) + 1;
+		}
+		--patternLength;
+
+		// items sharing a token score 100 whatever their characters
+		std::vector<std::int32_t> shared;
+		for (const auto& token : patternTokens) {
+			const auto hash = std::hash<std::string_view>{}(token);
+			const auto begin = std::ranges::lower_bound(tokens, std::make_pair(hash, a_first));
+			const auto end = std::ranges::lower_bound(tokens, std::make_pair(hash, a_first + a_count));
+			for (auto it = begin; it != end; ++it) {
+				shared.push_back(it->second);
+			}
+		}
+		std::ranges::sort(shared);
+
+		// a tiny margin, so that rounding in the scorer can't pass an item this rules out
+		const auto cutoff = a_scoreCutoff - 1e-6;
+
+		auto nextShared = shared.begin();
+		for (std::int32_t i = a_first; i < a_first + a_count; ++i) {
+			while (nextShared != shared.end() && *nextShared < i) {
+				++nextShared;
+			}
+			if (nextShared != shared.end() && *nextShared == i) {
+				a_candidates.push_back(i);
+				continue;
+			}
+
+			const auto& item = items[i];
+
+			std::uint32_t matched = 0;
+			for (auto common = patternCharacters & item.characters; common != 0; common &= common - 1) {
+				matched += counts[std::countr_zero(common)];
+			}
+
+			const auto shorter = std::min(patternLength, item.length);
+			if (shorter + matched == 0 || 200.0 * matched / (shorter + matched) >= cutoff) {
+				a_candidates.push_back(i);
+			}
+		}
+
+		return true;
+	}
+}
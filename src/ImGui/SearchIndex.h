@@ -0,0 +1,37 @@
+#pragma once
+
+namespace ImGui
+{
+	// Per-item character and token summaries of a ComboWithFilter list, used to skip items that can't reach the score cutoff
+	// without running partial_token_ratio on them. Never skips an item that would pass.
+	class SearchIndex
+	{
+	public:
+		void Build(std::span<const std::string_view> a_items);
+		void Clear();
+
+		[[nodiscard]] bool IsBuilt() const;
+
+		// Ascending indices in [a_first, a_first + a_count) of every item that can score at least a_scoreCutoff with partial_token_ratio.
+		// Returns false if the pattern has no tokens, in which case every item is a candidate. Thread-safe
+		bool GetCandidates(std::string_view a_pattern, double a_scoreCutoff, std::int32_t a_first, std::int32_t a_count, std::vector<std::int32_t>& a_candidates) const;
+
+	private:
+		struct Item
+		{
+			// members
+			std::uint64_t characters;  // buckets of the characters in the item's tokens, plus the space joining them
+			std::uint32_t length;      // of the item's unique tokens joined by spaces
+		};
+
+		static std::uint32_t GetBucket(char a_char);
+
+		template <class F>
+		static void ForEachToken(std::string_view a_str, F&& a_func);
+
+		// members
+		std::vector<Item>                                 items{};
+		std::vector<std::pair<std::size_t, std::int32_t>> tokens{};  // token hash, item. Sorted
+		bool                                              built{ false };
+	};
+}
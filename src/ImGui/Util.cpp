@@ -37,7 +37,7 @@ namespace ImGui
 		}
 	}
 
-	void AlignedImage(ImTextureID texID, const ImVec2& texture_size, const ImVec2& min, const ImVec2& max, const ImVec2& align, ImU32 colour)
+	void AlignedImage(ImTextureID texID, const ImVec2& texture_size, const ImVec2& min, const ImVec2& max, const ImVec2& align, ImU32 colour, const ImVec2& uv0, const ImVec2& uv1)
 	{
 		const ImGuiWindow* window = GetCurrentWindow();
 		ImVec2             pos = min;
@@ -47,7 +47,7 @@ namespace ImGui
 		if (align.y > 0.0f)
 			pos.y = ImMax(pos.y, pos.y + (max.y - pos.y - texture_size.y) * align.y);
 
-		window->DrawList->AddImage(texID, pos, pos + texture_size, ImVec2(0, 0), ImVec2(1, 1), colour);
+		window->DrawList->AddImage(texID, pos, pos + texture_size, uv0, uv1, colour);
 	}
 
 	void ExtendWindowPastBorder()
@@ -61,12 +61,13 @@ namespace ImGui
 		rootWindow->DrawList->AddRect(newWindowPos, newWindowPos + ImVec2(window->Size.x + 2 * borderSize, window->Size.y + 2 * borderSize), GetColorU32(ImGuiCol_WindowBg), 0.0f, 0, borderSize);
 	}
 
-	std::string LeftAlignedText(const char* label)
+	FrameString LeftAlignedText(const char* label)
 	{
 		const float width = CalcItemWidth();
 		const float x = GetCursorPosX();
 
-		const auto newLabel = "##"s + label;
+		FrameString newLabel{ "##", FrameAllocator() };
+		newLabel += label;
 
 		const auto hovered = GetFocusID() == GetCurrentWindow()->GetID(newLabel.c_str());
 		if (!hovered) {
@@ -87,12 +88,12 @@ namespace ImGui
 	void CenteredText(const char* label, bool vertical)
 	{
 		const auto windowSize = ImGui::GetWindowSize();
-		const auto textSize = ImGui::CalcTextSize(label);
 
 		if (vertical) {
-			ImGui::SetCursorPosY((windowSize.y - textSize.y) * 0.5f);
+			// labels are single line, so there's no need to measure them
+			ImGui::SetCursorPosY((windowSize.y - ImGui::GetTextLineHeight()) * 0.5f);
 		} else {
-			ImGui::SetCursorPosX((windowSize.x - textSize.x) * 0.5f);
+			ImGui::SetCursorPosX((windowSize.x - ImGui::CalcTextSize(label).x) * 0.5f);
 		}
 
 		ImGui::Text(label);
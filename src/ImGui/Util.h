@@ -6,11 +6,11 @@ namespace ImGui
 	float CalcMaxPopupHeightFromItemCount(int items_count);
 
 	void AlignForWidth(float width, float alignment = 0.5f);
-	void AlignedImage(ImTextureID texID, const ImVec2& texture_size, const ImVec2& min, const ImVec2& max, const ImVec2& align, ImU32 colour);
+	void AlignedImage(ImTextureID texID, const ImVec2& texture_size, const ImVec2& min, const ImVec2& max, const ImVec2& align, ImU32 colour, const ImVec2& uv0 = ImVec2(0, 0), const ImVec2& uv1 = ImVec2(1, 1));
 
 	void ExtendWindowPastBorder();
 
-	std::string LeftAlignedText(const char* label);
+	FrameString LeftAlignedText(const char* label);
 
 	void CenteredText(const char* label, bool vertical = false);
 
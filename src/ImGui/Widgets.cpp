@@ -4,183 +4,6 @@
 
 namespace ImGui
 {
-	// Source: https://gist.github.com/idbrii/5ddb2135ca122a0ec240ce046d9e6030
-	//
-	// Author: David Briscoe
-	//
-	// Modified ComboWithFilter with rapidFuzz
-	// Using dear imgui, v1.89 WIP
-	//
-	// Adds arrow/pgup/pgdn navigation, Enter to confirm, max_height_in_items, and
-	// fixed focus on open and avoids drawing past window edges.
-	//
-	// Licensed as CC0/public domain.
-	//
-	// Posted in issue: https://github.com/ocornut/imgui/issues/1658#issuecomment-1086193100
-
-	bool ComboWithFilter(const char* label, int* current_item, const std::vector<std::string>& items, int popup_max_height_in_items)
-	{
-		ImGuiContext& g = *GImGui;
-
-		ImGuiWindow* window = GetCurrentWindow();
-		if (window->SkipItems) {
-			return false;
-		}
-
-		const int items_count = static_cast<int>(items.size());
-
-		// Use imgui Items_ getters to support more input formats.
-		const char* preview_value = nullptr;
-		if (*current_item >= 0 && *current_item < items_count) {
-			preview_value = items[*current_item].c_str();
-		}
-
-		static int  focus_idx = -1;
-		static char pattern_buffer[MAX_PATH] = { 0 };
-
-		bool value_changed = false;
-
-		const ImGuiID id = window->GetID(label);
-		const ImGuiID popup_id = ImHashStr("##ComboPopup", 0, id);  // copied from BeginCombo
-		const bool    is_already_open = IsPopupOpen(popup_id, ImGuiPopupFlags_None);
-		const bool    is_filtering = is_already_open && pattern_buffer[0] != '\0';
-
-		int show_count = items_count;
-
-		std::vector<std::pair<int, double>> itemScoreVector;
-		if (is_filtering) {
-			// Filter before opening to ensure we show the correct size window.
-			// We won't get in here unless the popup is open.
-			for (int i = 0; i < items_count; i++) {
-				auto score = rapidfuzz::fuzz::partial_token_ratio(pattern_buffer, items[i].c_str());
-				if (score >= 65.0) {
-					itemScoreVector.push_back(std::make_pair(i, score));
-				}
-			}
-			std::ranges::sort(itemScoreVector, [](const auto& a, const auto& b) {
-				return (b.second < a.second);
-			});
-			const int current_score_idx = IndexOfKey(itemScoreVector, focus_idx);
-			if (current_score_idx < 0 && !itemScoreVector.empty()) {
-				focus_idx = itemScoreVector[0].first;
-			}
-			show_count = static_cast<int>(itemScoreVector.size());
-		}
-
-		// Define the height to ensure our size calculation is valid.
-		if (popup_max_height_in_items == -1) {
-			popup_max_height_in_items = 5;
-		}
-		popup_max_height_in_items = ImMin(popup_max_height_in_items, show_count);
-
-		if (!(g.NextWindowData.Flags & ImGuiNextWindowDataFlags_HasSizeConstraint)) {
-			const int numItems = popup_max_height_in_items + 2;  // extra for search bar
-			SetNextWindowSizeConstraints(ImVec2(0, 0), ImVec2(FLT_MAX,
-														   CalcMaxPopupHeightFromItemCount(numItems)));
-		}
-
-		if (!BeginCombo(label, preview_value, ImGuiComboFlags_None)) {
-			return false;
-		}
-
-		if (!is_already_open) {
-			focus_idx = *current_item;
-			memset(pattern_buffer, 0, IM_ARRAYSIZE(pattern_buffer));
-		}
-
-		ImGui::PushStyleColor(ImGuiCol_FrameBg, static_cast<ImVec4>(ImColor(0, 0, 0, 255)));
-		ImGui::PushStyleColor(ImGuiCol_Text, static_cast<ImVec4>(ImColor(255, 255, 255, 204)));
-		ImGui::PushStyleColor(ImGuiCol_NavHighlight, static_cast<ImVec4>(ImColor(0, 0, 0, 0)));
-		ImGui::PushItemWidth(-FLT_MIN);
-		// Filter input
-		if (!is_already_open) {
-			ImGui::SetKeyboardFocusHere();
-		}
-		InputText("##ComboWithFilter_inputText", pattern_buffer, MAX_PATH, ImGuiInputTextFlags_AutoSelectAll);
-
-		ImGui::PopStyleColor(3);
-
-		int move_delta = 0;
-		if (IsKeyPressed(ImGuiKey_UpArrow) || IsKeyPressed(ImGuiKey_GamepadDpadUp)) {
-			--move_delta;
-		} else if (IsKeyPressed(ImGuiKey_DownArrow) || IsKeyPressed(ImGuiKey_GamepadDpadDown)) {
-			++move_delta;
-		} else if (IsKeyPressed(ImGuiKey_PageUp)) {
-			move_delta -= popup_max_height_in_items;
-		} else if (IsKeyPressed(ImGuiKey_PageDown)) {
-			move_delta += popup_max_height_in_items;
-		}
-
-		if (move_delta != 0) {
-			if (is_filtering) {
-				int current_score_idx = IndexOfKey(itemScoreVector, focus_idx);
-				if (current_score_idx >= 0) {
-					const int count = static_cast<int>(itemScoreVector.size());
-					current_score_idx = ImClamp(current_score_idx + move_delta, 0, count - 1);
-					focus_idx = itemScoreVector[current_score_idx].first;
-				}
-			} else {
-				focus_idx = ImClamp(focus_idx + move_delta, 0, items_count - 1);
-			}
-			RE::PlaySound("UIMenuPrevNext");
-		}
-
-		// Copied from ListBoxHeader
-		// If popup_max_height_in_items == -1, default height is maximum 7.
-		const float height_in_items_f = (popup_max_height_in_items < 0 ? ImMin(items_count, 7) :
-                                                                         popup_max_height_in_items) +
-		                                0.25f;
-		ImVec2 size;
-		size.x = 0.0f;
-		size.y = GetTextLineHeightWithSpacing() * height_in_items_f + g.Style.FramePadding.y * 2.0f;
-
-		ImGui::PushStyleColor(ImGuiCol_NavHighlight, static_cast<ImVec4>(ImColor(0, 0, 0, 0)));
-		if (ImGui::BeginListBox("##ComboWithFilter_itemList", size)) {
-			for (int i = 0; i < show_count; i++) {
-				int idx = is_filtering ? itemScoreVector[i].first : i;
-				PushID(reinterpret_cast<void*>(static_cast<intptr_t>(idx)));
-				const bool  item_selected = (idx == focus_idx);
-				const char* item_text = items[idx].c_str();
-				if (Selectable(item_text, item_selected)) {
-					value_changed = true;
-					*current_item = idx;
-					CloseCurrentPopup();
-					RE::PlaySound("UIMenuFocus");
-				}
-
-				if (item_selected) {
-					SetItemDefaultFocus();
-					// SetItemDefaultFocus doesn't work so also check IsWindowAppearing.
-					if (move_delta != 0 || IsWindowAppearing()) {
-						SetScrollHereY();
-					}
-				}
-				PopID();
-			}
-			ImGui::EndListBox();
-
-			if (IsKeyPressed(ImGuiKey_Enter) || IsKeyPressed(ImGuiKey_Space) || IsKeyPressed(ImGuiKey_NavGamepadActivate)) {
-				value_changed = true;
-				*current_item = focus_idx;
-				CloseCurrentPopup();
-				RE::PlaySound("UIMenuOK");
-			} else if (IsKeyPressed(ImGuiKey_Escape) || IsKeyPressed(ImGuiKey_NavGamepadCancel)) {
-				value_changed = false;
-				CloseCurrentPopup();
-				RE::PlaySound("UIMenuCancel");
-			}
-		}
-		ImGui::PopStyleColor();
-		ImGui::PopItemWidth();
-		ImGui::EndCombo();
-
-		if (value_changed) {
-			MarkItemEdited(g.LastItemData.ID);
-		}
-
-		return value_changed;
-	}
-
 	bool ImGui::CenteredTextWithArrows(const char* label, std::string_view centerText)
 	{
 		ImGuiWindow* window = GetCurrentWindow();
@@ -221,8 +44,8 @@ namespace ImGui
 
 		const auto color = isHovered ? GetColorU32(ImGuiCol_Text) : GetColorU32(ImGuiCol_TextDisabled);
 
-		AlignedImage(leftArrow->srView.Get(), leftArrow->size, frame_bb.Min, frame_bb.Max, ImVec2(0, 0.5f), color);
-		AlignedImage(rightArrow->srView.Get(), rightArrow->size, frame_bb.Min, frame_bb.Max, ImVec2(1.0, 0.5f), color);
+		AlignedImage(leftArrow->srView.Get(), leftArrow->size, frame_bb.Min, frame_bb.Max, ImVec2(0, 0.5f), color, leftArrow->uv0, leftArrow->uv1);
+		AlignedImage(rightArrow->srView.Get(), rightArrow->size, frame_bb.Min, frame_bb.Max, ImVec2(1.0, 0.5f), color, rightArrow->uv0, rightArrow->uv1);
 
 		return isHovered;
 	}
@@ -242,7 +65,8 @@ namespace ImGui
 		PushStyleColor(ImGuiCol_ButtonActive, ImVec4());
 		PushStyleColor(ImGuiCol_ButtonHovered, ImVec4());
 
-		ImageButton(newLabel.c_str(), *a_toggle ? checkboxFilled->srView.Get() : checkbox->srView.Get(), checkbox->size, ImVec2(), ImVec2(1, 1), ImVec4(),
+		const auto icon = *a_toggle ? checkboxFilled : checkbox;
+		ImageButton(newLabel.c_str(), icon->srView.Get(), checkbox->size, icon->uv0, icon->uv1, ImVec4(),
 			GetFocusID() == GetCurrentWindow()->GetID(newLabel.c_str()) ? ImVec4(1, 1, 1, 1) : GetStyle().Colors[ImGuiCol_TextDisabled]);
 
 		PopStyleColor(3);
@@ -1,11 +1,10 @@
 #pragma once
 
+#include "ComboWithFilter.h"
 #include "Util.h"
 
 namespace ImGui
 {
-	bool ComboWithFilter(const char* label, int* current_item, const std::vector<std::string>& items, int popup_max_height_in_items = -1);
-
 	bool CenteredTextWithArrows(const char* label, std::string_view centerText);
 
 	bool CheckBox(const char* label, bool* a_toggle);
@@ -1,5 +1,6 @@
 #include "Input.h"
 
+#include "InputRecorder.h"
 #include "PhotoMode/Hotkeys.h"
 #include "PhotoMode/Manager.h"
 #include "Screenshots/Manager.h"
@@ -84,304 +85,188 @@ namespace Input
 		}
 	}
 
-	ImGuiKey Manager::ToImGuiKey(RE::BSWin32KeyboardDevice::Key a_key)
+	// (device key, ImGuiKey) pairs, expanded at compile time into tables indexed by the key
+	template <std::size_t N, class K, std::size_t M, class Index>
+	consteval std::array<ImGuiKey, N> MakeKeyTable(const std::array<std::pair<K, ImGuiKey>, M>& a_pairs, Index a_index)
 	{
-		switch (a_key) {
-		case KEY::kTab:
-			return ImGuiKey_Tab;
-		case KEY::kLeft:
-			return ImGuiKey_LeftArrow;
-		case KEY::kRight:
-			return ImGuiKey_RightArrow;
-		case KEY::kUp:
-			return ImGuiKey_UpArrow;
-		case KEY::kDown:
-			return ImGuiKey_DownArrow;
-		case KEY::kPageUp:
-			return ImGuiKey_PageUp;
-		case KEY::kPageDown:
-			return ImGuiKey_PageDown;
-		case KEY::kHome:
-			return ImGuiKey_Home;
-		case KEY::kEnd:
-			return ImGuiKey_End;
-		case KEY::kInsert:
-			return ImGuiKey_Insert;
-		case KEY::kDelete:
-			return ImGuiKey_Delete;
-		case KEY::kBackspace:
-			return ImGuiKey_Backspace;
-		case KEY::kSpacebar:
-			return ImGuiKey_Space;
-		case KEY::kEnter:
-			return ImGuiKey_Enter;
-		case KEY::kEscape:
-			return ImGuiKey_Escape;
-		case KEY::kApostrophe:
-			return ImGuiKey_Apostrophe;
-		case KEY::kComma:
-			return ImGuiKey_Comma;
-		case KEY::kMinus:
-			return ImGuiKey_Minus;
-		case KEY::kPeriod:
-			return ImGuiKey_Period;
-		case KEY::kSlash:
-			return ImGuiKey_Slash;
-		case KEY::kSemicolon:
-			return ImGuiKey_Semicolon;
-		case KEY::kEquals:
-			return ImGuiKey_Equal;
-		case KEY::kBracketLeft:
-			return ImGuiKey_LeftBracket;
-		case KEY::kBackslash:
-			return ImGuiKey_Backslash;
-		case KEY::kBracketRight:
-			return ImGuiKey_RightBracket;
-		case KEY::kTilde:
-			return ImGuiKey_GraveAccent;
-		case KEY::kCapsLock:
-			return ImGuiKey_CapsLock;
-		case KEY::kScrollLock:
-			return ImGuiKey_ScrollLock;
-		case KEY::kNumLock:
-			return ImGuiKey_NumLock;
-		case KEY::kPrintScreen:
-			return ImGuiKey_PrintScreen;
-		case KEY::kPause:
-			return ImGuiKey_Pause;
-		case KEY::kKP_0:
-			return ImGuiKey_Keypad0;
-		case KEY::kKP_1:
-			return ImGuiKey_Keypad1;
-		case KEY::kKP_2:
-			return ImGuiKey_Keypad2;
-		case KEY::kKP_3:
-			return ImGuiKey_Keypad3;
-		case KEY::kKP_4:
-			return ImGuiKey_Keypad4;
-		case KEY::kKP_5:
-			return ImGuiKey_Keypad5;
-		case KEY::kKP_6:
-			return ImGuiKey_Keypad6;
-		case KEY::kKP_7:
-			return ImGuiKey_Keypad7;
-		case KEY::kKP_8:
-			return ImGuiKey_Keypad8;
-		case KEY::kKP_9:
-			return ImGuiKey_Keypad9;
-		case KEY::kKP_Decimal:
-			return ImGuiKey_KeypadDecimal;
-		case KEY::kKP_Divide:
-			return ImGuiKey_KeypadDivide;
-		case KEY::kKP_Multiply:
-			return ImGuiKey_KeypadMultiply;
-		case KEY::kKP_Subtract:
-			return ImGuiKey_KeypadSubtract;
-		case KEY::kKP_Plus:
-			return ImGuiKey_KeypadAdd;
-		case KEY::kKP_Enter:
-			return ImGuiKey_KeypadEnter;
-		case KEY::kLeftShift:
-			return ImGuiKey_LeftShift;
-		case KEY::kLeftControl:
-			return ImGuiKey_LeftCtrl;
-		case KEY::kLeftAlt:
-			return ImGuiKey_LeftAlt;
-		case KEY::kLeftWin:
-			return ImGuiKey_LeftSuper;
-		case KEY::kRightShift:
-			return ImGuiKey_RightShift;
-		case KEY::kRightControl:
-			return ImGuiKey_RightCtrl;
-		case KEY::kRightAlt:
-			return ImGuiKey_RightAlt;
-		case KEY::kRightWin:
-			return ImGuiKey_RightSuper;
-		/*case KEY::kAPPS:
-			return ImGuiKey_Menu; - doesn't fire*/
-		case KEY::kNum0:
-			return ImGuiKey_0;
-		case KEY::kNum1:
-			return ImGuiKey_1;
-		case KEY::kNum2:
-			return ImGuiKey_2;
-		case KEY::kNum3:
-			return ImGuiKey_3;
-		case KEY::kNum4:
-			return ImGuiKey_4;
-		case KEY::kNum5:
-			return ImGuiKey_5;
-		case KEY::kNum6:
-			return ImGuiKey_6;
-		case KEY::kNum7:
-			return ImGuiKey_7;
-		case KEY::kNum8:
-			return ImGuiKey_8;
-		case KEY::kNum9:
-			return ImGuiKey_9;
-		case KEY::kA:
-			return ImGuiKey_A;
-		case KEY::kB:
-			return ImGuiKey_B;
-		case KEY::kC:
-			return ImGuiKey_C;
-		case KEY::kD:
-			return ImGuiKey_D;
-		case KEY::kE:
-			return ImGuiKey_E;
-		case KEY::kF:
-			return ImGuiKey_F;
-		case KEY::kG:
-			return ImGuiKey_G;
-		case KEY::kH:
-			return ImGuiKey_H;
-		case KEY::kI:
-			return ImGuiKey_I;
-		case KEY::kJ:
-			return ImGuiKey_J;
-		case KEY::kK:
-			return ImGuiKey_K;
-		case KEY::kL:
-			return ImGuiKey_L;
-		case KEY::kM:
-			return ImGuiKey_M;
-		case KEY::kN:
-			return ImGuiKey_N;
-		case KEY::kO:
-			return ImGuiKey_O;
-		case KEY::kP:
-			return ImGuiKey_P;
-		case KEY::kQ:
-			return ImGuiKey_Q;
-		case KEY::kR:
-			return ImGuiKey_R;
-		case KEY::kS:
-			return ImGuiKey_S;
-		case KEY::kT:
-			return ImGuiKey_T;
-		case KEY::kU:
-			return ImGuiKey_U;
-		case KEY::kV:
-			return ImGuiKey_V;
-		case KEY::kW:
-			return ImGuiKey_W;
-		case KEY::kX:
-			return ImGuiKey_X;
-		case KEY::kY:
-			return ImGuiKey_Y;
-		case KEY::kZ:
-			return ImGuiKey_Z;
-		case KEY::kF1:
-			return ImGuiKey_F1;
-		case KEY::kF2:
-			return ImGuiKey_F2;
-		case KEY::kF3:
-			return ImGuiKey_F3;
-		case KEY::kF4:
-			return ImGuiKey_F4;
-		case KEY::kF5:
-			return ImGuiKey_F5;
-		case KEY::kF6:
-			return ImGuiKey_F6;
-		case KEY::kF7:
-			return ImGuiKey_F7;
-		case KEY::kF8:
-			return ImGuiKey_F8;
-		case KEY::kF9:
-			return ImGuiKey_F9;
-		case KEY::kF10:
-			return ImGuiKey_F10;
-		case KEY::kF11:
-			return ImGuiKey_F11;
-		case KEY::kF12:
-			return ImGuiKey_F12;
-		default:
-			return ImGuiKey_None;
+		std::array<ImGuiKey, N> table{};
+		table.fill(ImGuiKey_None);
+		for (const auto& [key, imGuiKey] : a_pairs) {
+			table[a_index(key)] = imGuiKey;
 		}
+		return table;
 	}
 
-	ImGuiKey Manager::ToImGuiKey(GAMEPAD_DIRECTX a_key)
+	// gamepad keys are button masks
+	constexpr std::size_t GamepadIndex(std::uint32_t a_mask)
 	{
-		switch (a_key) {
-		case GAMEPAD_DIRECTX::kUp:
-			return ImGuiKey_GamepadDpadUp;
-		case GAMEPAD_DIRECTX::kDown:
-			return ImGuiKey_GamepadDpadDown;
-		case GAMEPAD_DIRECTX::kLeft:
-			return ImGuiKey_GamepadDpadLeft;
-		case GAMEPAD_DIRECTX::kRight:
-			return ImGuiKey_GamepadDpadRight;
-		case GAMEPAD_DIRECTX::kStart:
-			return ImGuiKey_GamepadStart;
-		case GAMEPAD_DIRECTX::kBack:
-			return ImGuiKey_GamepadBack;
-		case GAMEPAD_DIRECTX::kLeftThumb:
-			return ImGuiKey_GamepadL3;
-		case GAMEPAD_DIRECTX::kRightThumb:
-			return ImGuiKey_GamepadR3;
-		case GAMEPAD_DIRECTX::kLeftShoulder:
-			return ImGuiKey_GamepadL1;
-		case GAMEPAD_DIRECTX::kRightShoulder:
-			return ImGuiKey_GamepadR1;
-		case GAMEPAD_DIRECTX::kA:
-			return ImGuiKey_GamepadFaceDown;
-		case GAMEPAD_DIRECTX::kB:
-			return ImGuiKey_GamepadFaceRight;
-		case GAMEPAD_DIRECTX::kX:
-			return ImGuiKey_GamepadFaceLeft;
-		case GAMEPAD_DIRECTX::kY:
-			return ImGuiKey_GamepadFaceUp;
-		default:
-			return ImGuiKey_None;
-		}
+		return std::has_single_bit(a_mask) ? static_cast<std::size_t>(std::countr_zero(a_mask)) : 32;
 	}
 
+	constexpr auto keyboardKeys = MakeKeyTable<256>(std::to_array<std::pair<KEY, ImGuiKey>>({
+		{ KEY::kTab, ImGuiKey_Tab },
+		{ KEY::kLeft, ImGuiKey_LeftArrow },
+		{ KEY::kRight, ImGuiKey_RightArrow },
+		{ KEY::kUp, ImGuiKey_UpArrow },
+		{ KEY::kDown, ImGuiKey_DownArrow },
+		{ KEY::kPageUp, ImGuiKey_PageUp },
+		{ KEY::kPageDown, ImGuiKey_PageDown },
+		{ KEY::kHome, ImGuiKey_Home },
+		{ KEY::kEnd, ImGuiKey_End },
+		{ KEY::kInsert, ImGuiKey_Insert },
+		{ KEY::kDelete, ImGuiKey_Delete },
+		{ KEY::kBackspace, ImGuiKey_Backspace },
+		{ KEY::kSpacebar, ImGuiKey_Space },
+		{ KEY::kEnter, ImGuiKey_Enter },
+		{ KEY::kEscape, ImGuiKey_Escape },
+		{ KEY::kApostrophe, ImGuiKey_Apostrophe },
+		{ KEY::kComma, ImGuiKey_Comma },
+		{ KEY::kMinus, ImGuiKey_Minus },
+		{ KEY::kPeriod, ImGuiKey_Period },
+		{ KEY::kSlash, ImGuiKey_Slash },
+		{ KEY::kSemicolon, ImGuiKey_Semicolon },
+		{ KEY::kEquals, ImGuiKey_Equal },
+		{ KEY::kBracketLeft, ImGuiKey_LeftBracket },
+		{ KEY::kBackslash, ImGuiKey_Backslash },
+		{ KEY::kBracketRight, ImGuiKey_RightBracket },
+		{ KEY::kTilde, ImGuiKey_GraveAccent },
+		{ KEY::kCapsLock, ImGuiKey_CapsLock },
+		{ KEY::kScrollLock, ImGuiKey_ScrollLock },
+		{ KEY::kNumLock, ImGuiKey_NumLock },
+		{ KEY::kPrintScreen, ImGuiKey_PrintScreen },
+		{ KEY::kPause, ImGuiKey_Pause },
+		{ KEY::kKP_0, ImGuiKey_Keypad0 },
+		{ KEY::kKP_1, ImGuiKey_Keypad1 },
+		{ KEY::kKP_2, ImGuiKey_Keypad2 },
+		{ KEY::kKP_3, ImGuiKey_Keypad3 },
+		{ KEY::kKP_4, ImGuiKey_Keypad4 },
+		{ KEY::kKP_5, ImGuiKey_Keypad5 },
+		{ KEY::kKP_6, ImGuiKey_Keypad6 },
+		{ KEY::kKP_7, ImGuiKey_Keypad7 },
+		{ KEY::kKP_8, ImGuiKey_Keypad8 },
+		{ KEY::kKP_9, ImGuiKey_Keypad9 },
+		{ KEY::kKP_Decimal, ImGuiKey_KeypadDecimal },
+		{ KEY::kKP_Divide, ImGuiKey_KeypadDivide },
+		{ KEY::kKP_Multiply, ImGuiKey_KeypadMultiply },
+		{ KEY::kKP_Subtract, ImGuiKey_KeypadSubtract },
+		{ KEY::kKP_Plus, ImGuiKey_KeypadAdd },
+		{ KEY::kKP_Enter, ImGuiKey_KeypadEnter },
+		{ KEY::kLeftShift, ImGuiKey_LeftShift },
+		{ KEY::kLeftControl, ImGuiKey_LeftCtrl },
+		{ KEY::kLeftAlt, ImGuiKey_LeftAlt },
+		{ KEY::kLeftWin, ImGuiKey_LeftSuper },
+		{ KEY::kRightShift, ImGuiKey_RightShift },
+		{ KEY::kRightControl, ImGuiKey_RightCtrl },
+		{ KEY::kRightAlt, ImGuiKey_RightAlt },
+		{ KEY::kRightWin, ImGuiKey_RightSuper },
+		// { KEY::kAPPS, ImGuiKey_Menu } - doesn't fire
+		{ KEY::kNum0, ImGuiKey_0 },
+		{ KEY::kNum1, ImGuiKey_1 },
+		{ KEY::kNum2, ImGuiKey_2 },
+		{ KEY::kNum3, ImGuiKey_3 },
+		{ KEY::kNum4, ImGuiKey_4 },
+		{ KEY::kNum5, ImGuiKey_5 },
+		{ KEY::kNum6, ImGuiKey_6 },
+		{ KEY::kNum7, ImGuiKey_7 },
+		{ KEY::kNum8, ImGuiKey_8 },
+		{ KEY::kNum9, ImGuiKey_9 },
+		{ KEY::kA, ImGuiKey_A },
+		{ KEY::kB, ImGuiKey_B },
+		{ KEY::kC, ImGuiKey_C },
+		{ KEY::kD, ImGuiKey_D },
+		{ KEY::kE, ImGuiKey_E },
+		{ KEY::kF, ImGuiKey_F },
+		{ KEY::kG, ImGuiKey_G },
+		{ KEY::kH, ImGuiKey_H },
+		{ KEY::kI, ImGuiKey_I },
+		{ KEY::kJ, ImGuiKey_J },
+		{ KEY::kK, ImGuiKey_K },
+		{ KEY::kL, ImGuiKey_L },
+		{ KEY::kM, ImGuiKey_M },
+		{ KEY::kN, ImGuiKey_N },
+		{ KEY::kO, ImGuiKey_O },
+		{ KEY::kP, ImGuiKey_P },
+		{ KEY::kQ, ImGuiKey_Q },
+		{ KEY::kR, ImGuiKey_R },
+		{ KEY::kS, ImGuiKey_S },
+		{ KEY::kT, ImGuiKey_T },
+		{ KEY::kU, ImGuiKey_U },
+		{ KEY::kV, ImGuiKey_V },
+		{ KEY::kW, ImGuiKey_W },
+		{ KEY::kX, ImGuiKey_X },
+		{ KEY::kY, ImGuiKey_Y },
+		{ KEY::kZ, ImGuiKey_Z },
+		{ KEY::kF1, ImGuiKey_F1 },
+		{ KEY::kF2, ImGuiKey_F2 },
+		{ KEY::kF3, ImGuiKey_F3 },
+		{ KEY::kF4, ImGuiKey_F4 },
+		{ KEY::kF5, ImGuiKey_F5 },
+		{ KEY::kF6, ImGuiKey_F6 },
+		{ KEY::kF7, ImGuiKey_F7 },
+		{ KEY::kF8, ImGuiKey_F8 },
+		{ KEY::kF9, ImGuiKey_F9 },
+		{ KEY::kF10, ImGuiKey_F10 },
+		{ KEY::kF11, ImGuiKey_F11 },
+		{ KEY::kF12, ImGuiKey_F12 },
+	}),
+		[](KEY a_key) { return static_cast<std::size_t>(std::to_underlying(a_key)); });
+
+	constexpr auto directXKeys = MakeKeyTable<33>(std::to_array<std::pair<GAMEPAD_DIRECTX, ImGuiKey>>({
+		{ GAMEPAD_DIRECTX::kUp, ImGuiKey_GamepadDpadUp },
+		{ GAMEPAD_DIRECTX::kDown, ImGuiKey_GamepadDpadDown },
+		{ GAMEPAD_DIRECTX::kLeft, ImGuiKey_GamepadDpadLeft },
+		{ GAMEPAD_DIRECTX::kRight, ImGuiKey_GamepadDpadRight },
+		{ GAMEPAD_DIRECTX::kStart, ImGuiKey_GamepadStart },
+		{ GAMEPAD_DIRECTX::kBack, ImGuiKey_GamepadBack },
+		{ GAMEPAD_DIRECTX::kLeftThumb, ImGuiKey_GamepadL3 },
+		{ GAMEPAD_DIRECTX::kRightThumb, ImGuiKey_GamepadR3 },
+		{ GAMEPAD_DIRECTX::kLeftShoulder, ImGuiKey_GamepadL1 },
+		{ GAMEPAD_DIRECTX::kRightShoulder, ImGuiKey_GamepadR1 },
+		{ GAMEPAD_DIRECTX::kA, ImGuiKey_GamepadFaceDown },
+		{ GAMEPAD_DIRECTX::kB, ImGuiKey_GamepadFaceRight },
+		{ GAMEPAD_DIRECTX::kX, ImGuiKey_GamepadFaceLeft },
+		{ GAMEPAD_DIRECTX::kY, ImGuiKey_GamepadFaceUp },
+	}),
+		[](GAMEPAD_DIRECTX a_key) { return GamepadIndex(std::to_underlying(a_key)); });
+
 	// faking this with keyboard inputs, since ImGUI doesn't support DirectInput
-	ImGuiKey Manager::ToImGuiKey(GAMEPAD_ORBIS a_key)
-	{
-		switch (a_key) {
-		// Move / Tweak / Resize Window (in Windowing mode)
-		case GAMEPAD_ORBIS::kUp:
-			return ImGuiKey_UpArrow;
+	constexpr auto orbisKeys = MakeKeyTable<33>(std::to_array<std::pair<GAMEPAD_ORBIS, ImGuiKey>>({
 		// Move / Tweak / Resize Window (in Windowing mode)
-		case GAMEPAD_ORBIS::kDown:
-			return ImGuiKey_DownArrow;
-		// Move / Tweak / Resize Window (in Windowing mode)
-		case GAMEPAD_ORBIS::kLeft:
-			return ImGuiKey_LeftArrow;
-		// Move / Tweak / Resize Window (in Windowing mode)
-		case GAMEPAD_ORBIS::kRight:
-			return ImGuiKey_RightArrow;
-
-		case GAMEPAD_ORBIS::kPS3_Start:
-			return ImGuiKey_GamepadStart;
-		case GAMEPAD_ORBIS::kPS3_Back:
-			return ImGuiKey_GamepadBack;
-		case GAMEPAD_ORBIS::kPS3_L3:
-			return ImGuiKey_GamepadL3;
-		case GAMEPAD_ORBIS::kPS3_R3:
-			return ImGuiKey_GamepadR3;
-
+		{ GAMEPAD_ORBIS::kUp, ImGuiKey_UpArrow },
+		{ GAMEPAD_ORBIS::kDown, ImGuiKey_DownArrow },
+		{ GAMEPAD_ORBIS::kLeft, ImGuiKey_LeftArrow },
+		{ GAMEPAD_ORBIS::kRight, ImGuiKey_RightArrow },
+		{ GAMEPAD_ORBIS::kPS3_Start, ImGuiKey_GamepadStart },
+		{ GAMEPAD_ORBIS::kPS3_Back, ImGuiKey_GamepadBack },
+		{ GAMEPAD_ORBIS::kPS3_L3, ImGuiKey_GamepadL3 },
+		{ GAMEPAD_ORBIS::kPS3_R3, ImGuiKey_GamepadR3 },
 		// Tweak Slower / Focus Previous (in Windowing mode)
-		case GAMEPAD_ORBIS::kPS3_LB:
-			return ImGuiKey_NavKeyboardTweakSlow;
+		{ GAMEPAD_ORBIS::kPS3_LB, ImGuiKey_NavKeyboardTweakSlow },
 		// Tweak Faster / Focus Next (in Windowing mode)
-		case GAMEPAD_ORBIS::kPS3_RB:
-			return ImGuiKey_NavKeyboardTweakFast;
+		{ GAMEPAD_ORBIS::kPS3_RB, ImGuiKey_NavKeyboardTweakFast },
 		// Activate / Open / Toggle / Tweak
-		case GAMEPAD_ORBIS::kPS3_A:
-			return ImGuiKey_Enter;
+		{ GAMEPAD_ORBIS::kPS3_A, ImGuiKey_Enter },
 		// Cancel / Close / Exit
-		case GAMEPAD_ORBIS::kPS3_B:
-			return ImGuiKey_Escape;
+		{ GAMEPAD_ORBIS::kPS3_B, ImGuiKey_Escape },
+		{ GAMEPAD_ORBIS::kPS3_X, ImGuiKey_GamepadFaceLeft },
+		{ GAMEPAD_ORBIS::kPS3_Y, ImGuiKey_GamepadFaceUp },
+	}),
+		[](GAMEPAD_ORBIS a_key) { return GamepadIndex(std::to_underlying(a_key)); });
 
-		case GAMEPAD_ORBIS::kPS3_X:
-			return ImGuiKey_GamepadFaceLeft;
-		case GAMEPAD_ORBIS::kPS3_Y:
-			return ImGuiKey_GamepadFaceUp;
-		default:
-			return ImGuiKey_None;
-		}
+	ImGuiKey Manager::ToImGuiKey(KEY a_key)
+	{
+		const auto index = static_cast<std::size_t>(std::to_underlying(a_key));
+		return index < keyboardKeys.size() ? keyboardKeys[index] : ImGuiKey_None;
+	}
+
+	ImGuiKey Manager::ToImGuiKey(GAMEPAD_DIRECTX a_key)
+	{
+		return directXKeys[GamepadIndex(std::to_underlying(a_key))];
+	}
+
+	ImGuiKey Manager::ToImGuiKey(GAMEPAD_ORBIS a_key)
+	{
+		return orbisKeys[GamepadIndex(std::to_underlying(a_key))];
 	}
 
 	void Manager::SendKeyEvent(std::uint32_t a_key, bool a_keyPressed) const
@@ -419,91 +304,136 @@ namespace Input
 		}
 	}
 
-	EventResult Manager::ProcessEvent(RE::InputEvent* const* a_evn, RE::BSTEventSource<RE::InputEvent*>*)
+	void Manager::ProcessInput(const Event& a_event)
 	{
-		if (!a_evn || !RE::PlayerCharacter::GetSingleton()->Is3DLoaded() || !RE::Main::GetSingleton()->gameActive) {
-			return EventResult::kContinue;
+		if (a_event.kind == Event::KIND::kChar) {
+			ImGui::GetIO().AddInputCharacter(a_event.key);
+			return;
 		}
 
-		auto& io = ImGui::GetIO();
-
 		const auto photoMode = MANAGER(PhotoMode);
 		const auto hotKeys = MANAGER(PhotoMode::Hotkeys);
 
-		hotKeys->TogglePhotoMode(a_evn);
+		inputType = a_event.type;
 
-		if (photoMode->IsActive()) {
-			if (photoMode->ShouldBlockInput()) {
-				return EventResult::kContinue;
-			}
+		auto hotKey = a_event.key;
+		switch (a_event.device) {
+		case RE::INPUT_DEVICE::kMouse:
+			hotKey += SKSE::InputMap::kMacro_MouseButtonOffset;
+			break;
+		case RE::INPUT_DEVICE::kGamepad:
+			hotKey = SKSE::InputMap::GamepadMaskToKeycode(hotKey);
+			break;
+		default:
+			break;
+		}
 
-			for (auto event = *a_evn; event; event = event->next) {
-				// process inputs
-				if (const auto charEvent = event->AsCharEvent()) {
-					io.AddInputCharacter(charEvent->keycode);
-				} else if (const auto buttonEvent = event->AsButtonEvent()) {
-					const auto key = buttonEvent->GetIDCode();
-					const auto device = event->GetDevice();
-					auto       hotKey = key;
-
-					// get input type
-					switch (device) {
-					case RE::INPUT_DEVICE::kKeyboard:
-						inputType = TYPE::kKeyboard;
-						break;
-					case RE::INPUT_DEVICE::kMouse:
-						{
-							hotKey += SKSE::InputMap::kMacro_MouseButtonOffset;
-							inputType = TYPE::kKeyboard;
-						}
-						break;
-					case RE::INPUT_DEVICE::kGamepad:
-						{
-							hotKey = SKSE::InputMap::GamepadMaskToKeycode(hotKey);
-							if (RE::ControlMap::GetSingleton()->GetGamePadType() == RE::PC_GAMEPAD_TYPE::kOrbis) {
-								inputType = TYPE::kGamepadOrbis;
-							} else {
-								inputType = TYPE::kGamepadDirectX;
-							}
-						}
-						break;
-					default:
-						continue;
+		if (!ImGui::GetIO().WantTextInput) {
+			switch (hotKeys->GetAction(hotKey)) {
+			case Hotkeys::Manager::ACTION::kToggleMenus:
+				if (a_event.IsDown()) {
+					photoMode->ToggleUI();
+				}
+				break;
+			case Hotkeys::Manager::ACTION::kTakePhoto:
+				if (a_event.IsDown()) {
+					QueueScreenshot(hotKey != GetDefaultScreenshotKey(a_event.device));
+				} else if (a_event.IsUp()) {
+					MANAGER(Screenshot)->EndBurst();
+				} else if (MANAGER(Screenshot)->AllowMultiScreenshots() && a_event.heldDuration > keyHeldDuration && MANAGER(Screenshot)->QueueBurstShot()) {
+					QueueScreenshot(true);
+				}
+				break;
+			case Hotkeys::Manager::ACTION::kNextTab:
+				if (!photoMode->IsHidden() && a_event.IsDown()) {
+					photoMode->NavigateTab(false);
+				}
+				break;
+			case Hotkeys::Manager::ACTION::kPreviousTab:
+				if (!photoMode->IsHidden() && a_event.IsDown()) {
+					photoMode->NavigateTab(true);
+				}
+				break;
+			case Hotkeys::Manager::ACTION::kFreezeTime:
+				if (!photoMode->IsHidden() && a_event.IsDown()) {
+					RE::Main::GetSingleton()->freezeTime = !RE::Main::GetSingleton()->freezeTime;
+				}
+				break;
+			case Hotkeys::Manager::ACTION::kDrawWeaponsInput:
+				if (!photoMode->IsHidden() && a_event.IsDown()) {
+					photoMode->DrawWeapons();
+				}
+				break;
+			case Hotkeys::Manager::ACTION::kReset:
+				if (!photoMode->IsHidden()) {
+					if (a_event.IsUp()) {
+						photoMode->Revert(false);
+					} else if (a_event.heldDuration > keyHeldDuration) {
+						photoMode->DoResetAll();
 					}
+				}
+				break;
+			default:
+				break;
+			}
+		}
 
-					if (!io.WantTextInput) {
-						if (hotKey == hotKeys->ToggleMenusKey() && buttonEvent->IsDown()) {
-							photoMode->ToggleUI();
-						} else if (hotKey == hotKeys->TakePhotoKey()) {
-							if (buttonEvent->IsDown()) {
-								QueueScreenshot(hotKey != GetDefaultScreenshotKey(device));
-							} else if (MANAGER(Screenshot)->AllowMultiScreenshots() && buttonEvent->HeldDuration() > keyHeldDuration) {
-								QueueScreenshot(true);
-							}
-						} else if (!photoMode->IsHidden()) {
-							if (hotKey == hotKeys->NextTabKey() && buttonEvent->IsDown()) {
-								photoMode->NavigateTab(false);
-							} else if (hotKey == hotKeys->PreviousTabKey() && buttonEvent->IsDown()) {
-								photoMode->NavigateTab(true);
-							} else if (hotKey == hotKeys->FreezeTimeKey() && buttonEvent->IsDown()) {
-								RE::Main::GetSingleton()->freezeTime = !RE::Main::GetSingleton()->freezeTime;
-							} else if (hotKey == hotKeys->DrawWeaponsInputKey() && buttonEvent->IsDown()) {
-								photoMode->DrawWeapons();
-							} else if (hotKey == hotKeys->ResetKey()) {
-								if (buttonEvent->IsUp()) {
-									photoMode->Revert(false);
-								} else if (buttonEvent->HeldDuration() > keyHeldDuration) {
-									photoMode->DoResetAll();
-								}
-							}
-						}
-					}
+		if (a_event.device != RE::INPUT_DEVICE::kMouse && (!photoMode->IsHidden() || hotKey == hotKeys->EscapeKey())) {
+			SendKeyEvent(a_event.key, a_event.IsPressed());
+		}
+	}
+
+	EventResult Manager::ProcessEvent(RE::InputEvent* const* a_evn, RE::BSTEventSource<RE::InputEvent*>*)
+	{
+		if (!a_evn || !RE::PlayerCharacter::GetSingleton()->Is3DLoaded() || !RE::Main::GetSingleton()->gameActive) {
+			return EventResult::kContinue;
+		}
 
-					if (device != RE::INPUT_DEVICE::kMouse && (!photoMode->IsHidden() || hotKey == hotKeys->EscapeKey())) {
-						SendKeyEvent(key, buttonEvent->IsPressed());
+		const auto photoMode = MANAGER(PhotoMode);
+		const auto recorder = MANAGER(InputRecorder);
+
+		MANAGER(PhotoMode::Hotkeys)->TogglePhotoMode(a_evn);
+
+		// live input is ignored while a recording drives photo mode
+		if (!photoMode->IsActive() || photoMode->ShouldBlockInput() || recorder->IsReplaying()) {
+			return EventResult::kContinue;
+		}
+
+		for (auto event = *a_evn; event; event = event->next) {
+			Event input{};
+			input.device = event->GetDevice();
+
+			if (const auto charEvent = event->AsCharEvent()) {
+				input.kind = Event::KIND::kChar;
+				input.key = charEvent->keycode;
+			} else if (const auto buttonEvent = event->AsButtonEvent()) {
+				input.kind = Event::KIND::kButton;
+				input.key = buttonEvent->GetIDCode();
+				input.value = buttonEvent->Value();
+				input.heldDuration = buttonEvent->HeldDuration();
+
+				// get input type
+				switch (input.device) {
+				case RE::INPUT_DEVICE::kKeyboard:
+				case RE::INPUT_DEVICE::kMouse:
+					input.type = TYPE::kKeyboard;
+					break;
+				case RE::INPUT_DEVICE::kGamepad:
+					if (RE::ControlMap::GetSingleton()->GetGamePadType() == RE::PC_GAMEPAD_TYPE::kOrbis) {
+						input.type = TYPE::kGamepadOrbis;
+					} else {
+						input.type = TYPE::kGamepadDirectX;
 					}
+					break;
+				default:
+					continue;
 				}
+			} else {
+				continue;
 			}
+
+			recorder->Record(input);
+			ProcessInput(input);
 		}
 
 		return EventResult::kContinue;
@@ -1,14 +1,9 @@
 #pragma once
 
+#include "InputEvent.h"
+
 namespace Input
 {
-	enum class TYPE : std::uint32_t
-	{
-		kKeyboard,
-		kGamepadDirectX,  // xbox
-		kGamepadOrbis     // ps4
-	};
-
 	inline TYPE inputType;
 	TYPE        GetInputType();
 
@@ -23,6 +18,9 @@ namespace Input
 		void          LoadDefaultKeys();
 		std::uint32_t GetDefaultScreenshotKey(RE::INPUT_DEVICE a_device) const;
 
+		// dispatches to hotkeys and ImGui, for live and replayed input
+		void ProcessInput(const Event& a_event);
+
 		void HideMenu(bool a_hide);
 		bool IsScreenshotQueued() const;
 		void QueueScreenshot(bool a_forceQueue);
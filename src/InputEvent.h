@@ -0,0 +1,34 @@
+#pragma once
+
+namespace Input
+{
+	enum class TYPE : std::uint32_t
+	{
+		kKeyboard,
+		kGamepadDirectX,  // xbox
+		kGamepadOrbis     // ps4
+	};
+
+	// a button or character event, as the input sink sees it. Trivially copyable so recordings can be written as is
+	struct Event
+	{
+		enum class KIND : std::uint32_t
+		{
+			kButton,
+			kChar
+		};
+
+		bool IsPressed() const { return value > 0.0f; }
+		bool IsDown() const { return value > 0.0f && heldDuration == 0.0f; }
+		bool IsUp() const { return value == 0.0f && heldDuration > 0.0f; }
+
+		// members
+		std::uint32_t    frame{ 0 };  // photo mode frame it arrived on, set when recorded
+		KIND             kind{ KIND::kButton };
+		RE::INPUT_DEVICE device{ RE::INPUT_DEVICE::kKeyboard };
+		TYPE             type{ TYPE::kKeyboard };
+		std::uint32_t    key{ 0 };  // id code, or character
+		float            value{ 0.0f };
+		float            heldDuration{ 0.0f };
+	};
+}
@@ -0,0 +1,114 @@
+#include "InputRecorder.h"
+
+#include "Input.h"
+
+namespace InputRecorder
+{
+	void Manager::LoadMCMSettings(const CSimpleIniA& a_ini)
+	{
+		recordFile = a_ini.GetValue("Debug", "sRecordInput", "");
+		replayFile = a_ini.GetValue("Debug", "sReplayInput", "");
+	}
+
+	void Manager::Start()
+	{
+		session.Clear();
+		frameTimes.clear();
+		frame = 0;
+
+		if (!replayFile.empty()) {
+			const auto path = std::filesystem::path(recordingsFolder) / replayFile;
+			switch (session.Load(path)) {
+			case Recording::LoadResult::kLoaded:
+				replaying = true;
+				logger::info("Replaying {} input events over {} frames from {}", session.GetEvents().size(), session.GetFrameCount(), replayFile);
+				break;
+			case Recording::LoadResult::kMissing:
+				logger::warn("Unable to open input recording {}", path.string());
+				break;
+			case Recording::LoadResult::kInvalid:
+				logger::warn("{} is not an input recording", path.string());
+				break;
+			case Recording::LoadResult::kVersion:
+				logger::warn("Input recording {} was made by a different version", path.string());
+				break;
+			case Recording::LoadResult::kTruncated:
+				logger::warn("Input recording {} is truncated", path.string());
+				break;
+			}
+		} else if (!recordFile.empty()) {
+			recording = true;
+			logger::info("Recording input to {}", recordFile);
+		}
+	}
+
+	void Manager::Stop()
+	{
+		if (recording) {
+			recording = false;
+
+			const auto path = std::filesystem::path(recordingsFolder) / recordFile;
+			if (session.Save(path)) {
+				logger::info("Recorded {} input events over {} frames to {}", session.GetEvents().size(), session.GetFrameCount(), path.string());
+			} else {
+				logger::warn("Unable to write input recording {}", path.string());
+			}
+		}
+		if (replaying) {
+			replaying = false;
+			logger::info("Replay stopped early");
+			ReportFrameTimes();
+		}
+	}
+
+	void Manager::Record(Input::Event& a_event)
+	{
+		if (recording) {
+			session.Add(a_event);
+		}
+	}
+
+	void Manager::BeginFrame()
+	{
+		if (replaying) {
+			const auto input = MANAGER(Input);
+			for (const auto& event : session.GetFrameEvents(frame)) {
+				input->ProcessInput(event);
+			}
+		}
+	}
+
+	void Manager::EndFrame(std::chrono::steady_clock::duration a_frameTime)
+	{
+		if (recording) {
+			session.NextFrame();
+		} else if (replaying) {
+			++frame;
+			frameTimes.push_back(std::chrono::duration<float, std::milli>(a_frameTime).count());
+			if (session.IsFinished(frame)) {
+				replaying = false;
+				logger::info("Replay finished");
+				ReportFrameTimes();
+			}
+		}
+	}
+
+	void Manager::ReportFrameTimes()
+	{
+		if (frameTimes.empty()) {
+			return;
+		}
+
+		const auto total = std::accumulate(frameTimes.begin(), frameTimes.end(), 0.0f);
+		std::ranges::sort(frameTimes);
+
+		const auto percentile = [&](float a_percent) {
+			return frameTimes[static_cast<std::size_t>(a_percent * (frameTimes.size() - 1))];
+		};
+
+		logger::info("Replayed {} frames: mean {:.3f} ms, median {:.3f} ms, 95th {:.3f} ms, max {:.3f} ms",
+			frameTimes.size(), total / frameTimes.size(), percentile(0.5f), percentile(0.95f), frameTimes.back());
+
+		frameTimes.clear();
+	}
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "InputRecording.h"
+
+// Records the input photo mode receives, and replays it frame by frame to profile the UI.
+// [Debug] sRecordInput/sReplayInput name a file in the recordings folder, recording/replay starts when photo mode opens
+namespace InputRecorder
+{
+	class Manager final : public ISingleton<Manager>
+	{
+	public:
+		void LoadMCMSettings(const CSimpleIniA& a_ini);
+
+		void Start();
+		void Stop();
+
+		bool IsRecording() const { return recording; }
+		bool IsReplaying() const { return replaying; }
+
+		void Record(Input::Event& a_event);
+
+		// replayed events for this frame are sent before ImGui starts the frame
+		void BeginFrame();
+		void EndFrame(std::chrono::steady_clock::duration a_frameTime);
+
+	private:
+		void ReportFrameTimes();
+
+		static constexpr auto recordingsFolder{ R"(Data\SKSE\Plugins\PhotoMode\Recordings)" };
+
+		// members
+		std::string recordFile{};
+		std::string replayFile{};
+
+		bool recording{ false };
+		bool replaying{ false };
+
+		Recording     session{};
+		std::uint32_t frame{ 0 };  // of the replay
+
+		std::vector<float> frameTimes{};  // ms, of replayed frames
+	};
+}
@@ -0,0 +1,78 @@
+#include "InputRecording.h"
+
+namespace InputRecorder
+{
+	Recording::LoadResult Recording::Load(const std::filesystem::path& a_path)
+	{
+		Clear();
+
+		std::ifstream stream(a_path, std::ios::binary);
+		if (!stream.good()) {
+			return LoadResult::kMissing;
+		}
+
+		Header header{};
+		if (!stream.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic != Header::MAGIC) {
+			return LoadResult::kInvalid;
+		}
+		if (header.version != Header::VERSION || header.eventSize != sizeof(Input::Event)) {
+			return LoadResult::kVersion;
+		}
+
+		// a truncated recording must not size the allocation below
+		std::error_code ec;
+		const auto      fileSize = std::filesystem::file_size(a_path, ec);
+		if (ec || fileSize != sizeof(Header) + std::uint64_t(header.count) * sizeof(Input::Event)) {
+			return LoadResult::kTruncated;
+		}
+
+		events.resize(header.count);
+		if (!stream.read(reinterpret_cast<char*>(events.data()), events.size() * sizeof(Input::Event))) {
+			events.clear();
+			return LoadResult::kTruncated;
+		}
+		frameCount = header.frameCount;
+
+		return LoadResult::kLoaded;
+	}
+
+	bool Recording::Save(const std::filesystem::path& a_path) const
+	{
+		std::error_code ec;
+		std::filesystem::create_directories(a_path.parent_path(), ec);
+
+		std::ofstream stream(a_path, std::ios::binary | std::ios::trunc);
+		if (!stream.good()) {
+			return false;
+		}
+
+		const Header header{ Header::MAGIC, Header::VERSION, sizeof(Input::Event), static_cast<std::uint32_t>(events.size()), frameCount };
+
+		stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		stream.write(reinterpret_cast<const char*>(events.data()), events.size() * sizeof(Input::Event));
+
+		return stream.good();
+	}
+
+	void Recording::Clear()
+	{
+		events.clear();
+		frameCount = 0;
+		nextEvent = 0;
+	}
+
+	void Recording::Add(Input::Event& a_event)
+	{
+		a_event.frame = frameCount;
+		events.push_back(a_event);
+	}
+
+	std::span<const Input::Event> Recording::GetFrameEvents(std::uint32_t a_frame)
+	{
+		const auto first = nextEvent;
+		while (nextEvent < events.size() && events[nextEvent].frame <= a_frame) {
+			++nextEvent;
+		}
+		return std::span(events).subspan(first, nextEvent - first);
+	}
+}
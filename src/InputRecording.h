@@ -0,0 +1,60 @@
+#pragma once
+
+#include "InputEvent.h"
+
+namespace InputRecorder
+{
+	// The recorded input events and the number of frames they span, and the file they are saved to.
+	// Platform neutral, so that the tests can replay a session without the game
+	class Recording
+	{
+	public:
+		enum class LoadResult
+		{
+			kLoaded,
+			kMissing,
+			kInvalid,    // not a recording
+			kVersion,    // made by a version with another event layout
+			kTruncated,
+		};
+
+		LoadResult Load(const std::filesystem::path& a_path);
+		bool       Save(const std::filesystem::path& a_path) const;
+
+		void Clear();
+
+		// sets a_event.frame to the current frame
+		void Add(Input::Event& a_event);
+		// ends the current frame while recording
+		void NextFrame() { ++frameCount; }
+
+		// the events that arrived on a_frame, in order. Frames are read in order from Rewind()
+		std::span<const Input::Event> GetFrameEvents(std::uint32_t a_frame);
+		void                          Rewind() { nextEvent = 0; }
+
+		// every event was read and a_frame is past the last recorded frame
+		[[nodiscard]] bool IsFinished(std::uint32_t a_frame) const { return a_frame >= frameCount && nextEvent >= events.size(); }
+
+		[[nodiscard]] std::span<const Input::Event> GetEvents() const { return events; }
+		[[nodiscard]] std::uint32_t                 GetFrameCount() const { return frameCount; }
+
+	private:
+		struct Header
+		{
+			static constexpr std::uint32_t MAGIC = 0x52494D50;  // PMIR
+			static constexpr std::uint32_t VERSION = 2;
+
+			// members
+			std::uint32_t magic;
+			std::uint32_t version;
+			std::uint32_t eventSize;  // sizeof(Input::Event), events are dumped as is
+			std::uint32_t count;
+			std::uint32_t frameCount;
+		};
+
+		// members
+		std::vector<Input::Event> events{};
+		std::uint32_t             frameCount{ 0 };
+		std::size_t               nextEvent{ 0 };  // first event not replayed yet
+	};
+}
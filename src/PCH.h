@@ -2,14 +2,12 @@
 
 #define WIN32_LEAN_AND_MEAN
 #define NOMINMAX
-#define _SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING
 
 #define MANAGER(T) T::Manager::GetSingleton()
 
 #include "RE/Skyrim.h"
 #include "SKSE/SKSE.h"
 
-#include <codecvt>
 #include <wrl/client.h>
 
 #include <ClibUtil/RNG.hpp>
@@ -99,6 +97,8 @@ namespace stl
 #	define OFFSET(se, ae) se
 #endif
 
+#include "StringPool.h"
+#include "FrameArena.h"
 #include "Cache.h"
 #include "Translation.h"
 #include "Version.h"
@@ -17,6 +17,26 @@ namespace PhotoMode::Hotkeys
 		previousTab.LoadKeys(a_ini, "iPreviousTab");
 		freezeTime.LoadKeys(a_ini, "iFreezeTime");
 		drawWeaponsInput.LoadKeys(a_ini, "iDrawWeaponsInput");
+
+		// keyboard/mouse and gamepad codes don't overlap, so both devices share one table. If a key is bound twice, the first action listed wins
+		actions.fill(ACTION::kNone);
+
+		const std::array<std::pair<const Key*, ACTION>, 7> bindings{ {
+			{ &toggleMenus, ACTION::kToggleMenus },
+			{ &takePhoto, ACTION::kTakePhoto },
+			{ &nextTab, ACTION::kNextTab },
+			{ &previousTab, ACTION::kPreviousTab },
+			{ &freezeTime, ACTION::kFreezeTime },
+			{ &drawWeaponsInput, ACTION::kDrawWeaponsInput },
+			{ &reset, ACTION::kReset },
+		} };
+		for (const auto& [key, action] : bindings) {
+			for (const auto code : { key->Keyboard(), key->GamePad() }) {
+				if (code < actions.size() && actions[code] == ACTION::kNone) {
+					actions[code] = action;
+				}
+			}
+		}
 	}
 
 	void Manager::TogglePhotoMode(RE::InputEvent* const* a_event)
@@ -25,9 +45,9 @@ namespace PhotoMode::Hotkeys
 			return;
 		}
 
-		togglePhotoMode.ProcessKeyPress(a_event, []() {
+		if (togglePhotoMode.ProcessKeyPress(a_event)) {
 			MANAGER(PhotoMode)->ToggleActive();
-		});
+		}
 	}
 
 	void Manager::Key::LoadKeys(const CSimpleIniA& a_ini, std::string_view a_setting)
@@ -59,13 +79,15 @@ namespace PhotoMode::Hotkeys
 		primary = a_ini.GetLongValue("Controls", a_setting.data(), primary);
 		modifier = a_ini.GetLongValue("Controls", fmt::format("{}Modifier", a_setting).c_str(), modifier);
 
-		keys.clear();
-		if (primary != -1) {
-			keys.insert(primary);
-		}
-		if (modifier != -1) {
-			keys.insert(modifier);
+		keys.reset();
+		keyCodes.clear();
+		for (const auto key : { primary, modifier }) {
+			if (key >= 0 && static_cast<std::size_t>(key) < keys.size() && !keys.test(key)) {
+				keys.set(key);
+				keyCodes.push_back(static_cast<std::uint32_t>(key));
+			}
 		}
+		std::ranges::sort(keyCodes);
 	}
 
 	void Manager::KeyCombo::LoadKeys(const CSimpleIniA& a_ini)
@@ -76,20 +98,21 @@ namespace PhotoMode::Hotkeys
 
 	bool Manager::KeyCombo::IsInvalid() const
 	{
-		return keyboard.keys.empty() && gamePad.keys.empty();
+		return keyboard.keys.none() && gamePad.keys.none();
 	}
 
-	std::set<std::uint32_t> Manager::KeyCombo::GetKeys() const
+	std::span<const std::uint32_t> Manager::KeyCombo::GetKeys() const
 	{
 		if (Input::GetInputType() == Input::TYPE::kKeyboard) {
-			return keyboard.keys;
+			return keyboard.keyCodes;
 		}
-		return gamePad.keys;
+		return gamePad.keyCodes;
 	}
 
-	bool Manager::KeyCombo::ProcessKeyPress(RE::InputEvent* const* a_event, std::function<void()> a_callback)
+	bool Manager::KeyCombo::ProcessKeyPress(RE::InputEvent* const* a_event)
 	{
-		std::set<std::uint32_t> pressed;
+		KeySet pressed;
+		bool   unmappedPressed = false;
 
 		for (auto event = *a_event; event; event = event->next) {
 			const auto button = event->AsButtonEvent();
@@ -110,20 +133,24 @@ namespace PhotoMode::Hotkeys
 				default:
 					continue;
 				}
-				pressed.insert(key);
+				if (key < pressed.size()) {
+					pressed.set(key);
+				} else {
+					unmappedPressed = true;
+				}
 			}
 		}
 
-		if (!pressed.empty() && (pressed == keyboard.keys || pressed == gamePad.keys)) {
+		if (!unmappedPressed && pressed.any() && (pressed == keyboard.keys || pressed == gamePad.keys)) {
 			if (!triggered) {
 				triggered = true;
-				a_callback();
+				return true;
 			}
 		} else {
 			triggered = false;
 		}
 
-		return triggered;
+		return false;
 	}
 
 	std::uint32_t Manager::ResetKey() const
@@ -204,7 +231,7 @@ namespace PhotoMode::Hotkeys
 		return MANAGER(IconFont)->GetIcon(drawWeaponsInput.GetKey());
 	}
 
-	std::set<const IconFont::IconData*> Manager::TogglePhotoModeIcons() const
+	FrameVector<const IconFont::IconData*> Manager::TogglePhotoModeIcons() const
 	{
 		return MANAGER(IconFont)->GetIcons(togglePhotoMode.GetKeys());
 	}
@@ -10,8 +10,26 @@ namespace PhotoMode::Hotkeys
 	class Manager : public ISingleton<Manager>
 	{
 	public:
+		enum class ACTION : std::uint8_t
+		{
+			kNone,
+			kToggleMenus,
+			kTakePhoto,
+			kNextTab,
+			kPreviousTab,
+			kFreezeTime,
+			kDrawWeaponsInput,
+			kReset
+		};
+
 		void LoadHotKeys(const CSimpleIniA& a_ini);
 
+		// action bound to a keyboard, mouse or gamepad key code
+		ACTION GetAction(std::uint32_t a_key) const
+		{
+			return a_key < actions.size() ? actions[a_key] : ACTION::kNone;
+		}
+
 		void TogglePhotoMode(RE::InputEvent* const* a_event);
 
 		std::uint32_t        ResetKey() const;
@@ -31,9 +49,11 @@ namespace PhotoMode::Hotkeys
 		const IconFont::IconData* FreezeTimeIcon() const;
 		const IconFont::IconData* DrawWeaponsInputIcon() const;
 
-		std::set<const IconFont::IconData*> TogglePhotoModeIcons() const;
+		FrameVector<const IconFont::IconData*> TogglePhotoModeIcons() const;
 
 	private:
+		using KeySet = std::bitset<SKSE::InputMap::kMaxMacros>;
+
 		struct Key
 		{
 			void          LoadKeys(const CSimpleIniA& a_ini, std::string_view a_setting);
@@ -51,10 +71,11 @@ namespace PhotoMode::Hotkeys
 		{
 			void LoadKeys(const CSimpleIniA& a_ini);
 
-			bool                    IsInvalid() const;
-			std::set<std::uint32_t> GetKeys() const;
+			bool                           IsInvalid() const;
+			std::span<const std::uint32_t> GetKeys() const;
 
-			bool ProcessKeyPress(RE::InputEvent* const* a_event, std::function<void()> a_callback);
+			// true on the event the combo becomes held
+			bool ProcessKeyPress(RE::InputEvent* const* a_event);
 
 		private:
 			struct KeyComboImpl
@@ -64,7 +85,8 @@ namespace PhotoMode::Hotkeys
 				std::int32_t primary{ -1 };
 				std::int32_t modifier{ -1 };
 
-				std::set<std::uint32_t> keys{};
+				KeySet                     keys{};
+				std::vector<std::uint32_t> keyCodes{};  // sorted, for icons
 			};
 
 			KeyComboImpl keyboard;
@@ -80,6 +102,8 @@ namespace PhotoMode::Hotkeys
 		Key reset;
 		Key freezeTime;
 		Key drawWeaponsInput;
+
+		std::array<ACTION, SKSE::InputMap::kMaxMacros> actions{};
 	};
 }
 namespace Hotkeys = PhotoMode::Hotkeys;
@@ -6,6 +6,7 @@
 #include "Screenshots/Manager.h"
 
 #include "Input.h"
+#include "InputRecorder.h"
 
 namespace PhotoMode
 {
@@ -13,6 +14,11 @@ namespace PhotoMode
 	{
 		RE::UI::GetSingleton()->AddEventSink(GetSingleton());
 		logger::info("Registered for menu open/close event");
+
+		const auto scripts = RE::ScriptEventSourceHolder::GetSingleton();
+		scripts->AddEventSink<RE::TESContainerChangedEvent>(GetSingleton());
+		scripts->AddEventSink<RE::TESEquipEvent>(GetSingleton());
+		logger::info("Registered for container changed/equip events");
 	}
 
 	void Manager::LoadMCMSettings(const CSimpleIniA& a_ini)
@@ -94,6 +100,26 @@ namespace PhotoMode
 
 	void Manager::Activate()
 	{
+		activateTime = std::chrono::steady_clock::now();
+		firstFrameDrawn = false;
+
+		// hotkeys may have been rebound in the MCM
+		layout.valid = false;
+
+		if (formCatalogueTask.valid()) {
+			if (formCatalogueTask.wait_for(0s) != std::future_status::ready) {
+				logger::info("Waiting for form catalogues...");
+			}
+			try {
+				formCatalogueTask.get();
+			} catch (const std::exception& e) {
+				logger::error("Failed to build form catalogues ({})", e.what());
+			}
+		}
+
+		// idle conditions depend on the world state, so validity is only reused within a session
+		ImGui::IdleValidity::GetSingleton()->Clear();
+
 		cameraTab.GetOriginalState();
 		timeTab.GetOriginalState();
 
@@ -133,6 +159,8 @@ namespace PhotoMode
 		// keybindings can change?
 		MANAGER(Input)->LoadDefaultKeys();
 
+		MANAGER(InputRecorder)->Start();
+
 		activated = true;
 		if (activeGlobal) {
 			activeGlobal->value = 1.0f;
@@ -178,10 +206,13 @@ namespace PhotoMode
 
 	void Manager::Deactivate()
 	{
+		MANAGER(InputRecorder)->Stop();
+
 		Revert(true);
 
 		//reset characters
 		characterTab.clear();
+		selectedCharacters.clear();
 		cachedCharacter = nullptr;
 
 		// reset camera
@@ -248,7 +279,17 @@ namespace PhotoMode
 		// Character
 		if (tabIndex == kCharacter) {
 			if (cachedCharacter) {
-				characterTab[cachedCharacter->GetFormID()].RevertState();
+				const auto formID = cachedCharacter->GetFormID();
+				// group changes were applied to every selected character, so they are reverted together
+				if (selectedCharacters.contains(formID)) {
+					for (const auto& id : selectedCharacters) {
+						if (const auto it = characterTab.find(id); it != characterTab.end()) {
+							it->second.RevertState();
+						}
+					}
+				} else {
+					characterTab[formID].RevertState();
+				}
 			}
 		} else if (tabIndex == -1) {
 			std::for_each(characterTab.begin(), characterTab.end(), [](auto& data) {
@@ -324,10 +365,84 @@ namespace PhotoMode
 		}
 	}
 
+	void Manager::CollectForms(ImFontGlyphRangesBuilder& a_builder)
+	{
+		const auto start = std::chrono::steady_clock::now();
+
+		MANAGER(EditorID)->CacheEditorIDs<RE::TESWeather, RE::TESImageSpaceModifier, RE::TESEffectShader, RE::BGSReferenceEffect>();
+
+		ImGui::FormCatalogue<RE::TESWeather>::GetSingleton()->Collect();
+		ImGui::FormCatalogue<RE::TESImageSpaceModifier>::GetSingleton()->Collect();
+		ImGui::FormCatalogue<RE::TESEffectShader>::GetSingleton()->Collect();
+		ImGui::FormCatalogue<RE::BGSReferenceEffect>::GetSingleton()->Collect();
+		ImGui::FormCatalogue<RE::TESIdleForm>::GetSingleton()->Collect();
+
+		// character, inventory and spell names are only known once photo mode opens, so every name they can show is added
+		const auto add_names = [&]<class T>() {
+			for (const auto& form : RE::TESDataHandler::GetSingleton()->GetFormArray<T>()) {
+				if (const auto name = form ? form->GetName() : nullptr) {
+					a_builder.AddText(name);
+				}
+			}
+		};
+		add_names.operator()<RE::TESNPC>();
+		add_names.operator()<RE::TESObjectWEAP>();
+		add_names.operator()<RE::TESObjectARMO>();
+		add_names.operator()<RE::SpellItem>();
+
+		logger::info("Collected forms in {:.2f} ms", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+	}
+
+	void Manager::BuildFormCatalogues(ImFontGlyphRangesBuilder a_builder)
+	{
+		const auto start = std::chrono::steady_clock::now();
+
+		ImGui::FormCatalogue<RE::TESWeather>::GetSingleton()->Init();
+		ImGui::FormCatalogue<RE::TESImageSpaceModifier>::GetSingleton()->Init();
+		ImGui::FormCatalogue<RE::TESEffectShader>::GetSingleton()->Init();
+		ImGui::FormCatalogue<RE::BGSReferenceEffect>::GetSingleton()->Init();
+		ImGui::FormCatalogue<RE::TESIdleForm>::GetSingleton()->Init();
+
+		BuildGlyphRanges(a_builder);
+
+		logger::info("Built form catalogues in {:.2f} ms", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+	}
+
+	void Manager::BuildGlyphRanges(ImFontGlyphRangesBuilder& a_builder)
+	{
+		// translations are '\0' separated, which AddText would add as codepoint 0
+		for (const auto translation : MANAGER(Translation)->GetText() | std::views::split('\0')) {
+			a_builder.AddText(std::ranges::data(translation), std::ranges::data(translation) + std::ranges::size(translation));
+		}
+
+		const auto add_catalogue = [&]<class T>() {
+			const auto catalogue = ImGui::FormCatalogue<T>::GetSingleton();
+			for (const auto& modName : catalogue->GetModNames()) {
+				a_builder.AddText(modName.data(), modName.data() + modName.size());
+			}
+			for (const auto& name : catalogue->GetForms(0).names) {
+				a_builder.AddText(name.data(), name.data() + name.size());
+			}
+		};
+		add_catalogue.operator()<RE::TESWeather>();
+		add_catalogue.operator()<RE::TESImageSpaceModifier>();
+		add_catalogue.operator()<RE::TESEffectShader>();
+		add_catalogue.operator()<RE::BGSReferenceEffect>();
+		add_catalogue.operator()<RE::TESIdleForm>();
+
+		MANAGER(IconFont)->BuildGlyphRanges(a_builder);
+	}
+
 	void Manager::OnDataLoad()
 	{
 		overlaysTab.LoadOverlays();
 
+		// engine forms aren't thread-safe, so they are copied here and the worker only sorts and indexes the copies.
+		// Translations are loaded by now, which the catalogues need for their mod names
+		ImFontGlyphRangesBuilder builder;
+		CollectForms(builder);
+		formCatalogueTask = std::async(std::launch::async, BuildFormCatalogues, std::move(builder));
+
 		activeGlobal = RE::TESForm::LookupByEditorID<RE::TESGlobal>("PhotoMode_IsActive");
 		resetRootIdle = RE::TESForm::LookupByEditorID<RE::TESIdleForm>("ResetRoot");
 	}
@@ -348,6 +463,8 @@ namespace PhotoMode
 			overlaysTab.DrawOverlays();
 
 			if (!IsHidden()) {
+				UpdateLayout();
+
 				CameraGrid::Draw();
 				DrawBar();
 				DrawControls();
@@ -361,20 +478,66 @@ namespace PhotoMode
 			}
 		}
 		ImGui::End();
+
+		if (!firstFrameDrawn) {
+			firstFrameDrawn = true;
+			logger::info("Photo Mode first frame drawn {:.2f} ms after activation", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - activateTime).count());
+		}
 	}
 
-	void Manager::DrawControls()
+	void Manager::UpdateLayout()
 	{
-		const auto io = ImGui::GetIO();
+		const auto viewportSize = ImGui::GetNativeViewportSize();
+
+		const Layout::Key key{
+			Translation::Manager::GetSingleton()->GetLanguage(),
+			Input::GetInputType(),
+			MANAGER(IconFont)->GetButtonScheme(),
+			viewportSize.x,
+			viewportSize.y,
+			ImGui::GetFont(),
+			ImGui::GetFontSize()
+		};
 
-		const static auto center = ImGui::GetNativeViewportCenter();
-		const static auto size = ImGui::GetNativeViewportSize();
+		if (layout.valid && layout.key == key) {
+			return;
+		}
+
+		layout.key = key;
+		layout.valid = true;
+
+		const auto center = ImGui::GetNativeViewportCenter();
+		const auto hotkeys = MANAGER(Hotkeys);
 
-		const static auto third_width = size.x / 3;
-		const static auto third_height = size.y / 3;
+		// control bar
+		layout.barPos = ImVec2(center.x, viewportSize.y - viewportSize.y / 20.25f);  // same offset as control window
+		layout.barIcons = { hotkeys->TakePhotoIcon(), hotkeys->ToggleMenusIcon(), hotkeys->FreezeTimeIcon(), hotkeys->DrawWeaponsInputIcon(), hotkeys->ResetIcon() };
+		layout.barLabels = { "$PM_TAKEPHOTO"_T, "$PM_TOGGLEMENUS"_T, "$PM_FREEZETIME"_T, "$PM_DRAWWEAPONSCONTROL"_T, "$PM_RESET"_T };
+		layout.resetAllLabel = "$PM_RESET_ALL"_T;
 
-		ImGui::SetNextWindowPos(ImVec2(center.x + third_width, center.y + third_height * 0.8f), ImGuiCond_Always, ImVec2(0.5, 0.5));
-		ImGui::SetNextWindowSize(ImVec2(size.x / 3.25f, size.y / 3.125f));
+		const ImGuiStyle& style = ImGui::GetStyle();
+
+		layout.barWidth = 0.0f;
+		for (std::size_t i = 0; i < layout.barIcons.size(); ++i) {
+			layout.barWidth += layout.barIcons[i]->size.x;
+			layout.barWidth += style.ItemSpacing.x;
+			layout.barWidth += ImGui::CalcTextSize(layout.barLabels[i]).x;
+			layout.barWidth += style.ItemSpacing.x;
+		}
+		layout.resetAllExtraWidth = ImGui::CalcTextSize(layout.resetAllLabel).x - ImGui::CalcTextSize(layout.barLabels.back()).x;
+
+		// control window
+		layout.controlsPos = ImVec2(center.x + viewportSize.x / 3, center.y + viewportSize.y / 3 * 0.8f);
+		layout.controlsSize = ImVec2(viewportSize.x / 3.25f, viewportSize.y / 3.125f);
+		layout.previousTabIcon = MANAGER(IconFont)->GetIcon(hotkeys->PreviousTabKey());
+		layout.nextTabIcon = MANAGER(IconFont)->GetIcon(hotkeys->NextTabKey());
+		layout.tabWidth = -1.0f;
+	}
+
+	void Manager::DrawControls()
+	{
+		ImGui::SetNextWindowPos(layout.controlsPos, ImGuiCond_Always, ImVec2(0.5, 0.5));
+		ImGui::SetNextWindowSize(layout.controlsSize);
 
 		constexpr auto windowFlags = ImGuiWindowFlags_NoMouseInputs | ImGuiWindowFlags_NoDecoration;
 
@@ -389,10 +552,13 @@ namespace PhotoMode
 			// Q [Tab Tab Tab Tab Tab] E
 			ImGui::BeginGroup();
 			{
-				const auto buttonSize = ImGui::ButtonIcon(MANAGER(Hotkeys)->PreviousTabKey());
+				const auto buttonSize = ImGui::ButtonIcon(layout.previousTabIcon, false);
 				ImGui::SameLine();
 
-				const float tabWidth = (ImGui::GetContentRegionAvail().x - (buttonSize.x + ImGui::GetStyle().ItemSpacing.x * tabs.size())) / tabs.size();
+				if (layout.tabWidth < 0.0f) {
+					layout.tabWidth = (ImGui::GetContentRegionAvail().x - (buttonSize.x + ImGui::GetStyle().ItemSpacing.x * tabs.size())) / tabs.size();
+				}
+				const float tabWidth = layout.tabWidth;
 
 				ImGui::PushItemFlag(ImGuiItemFlags_NoNav, true);
 				ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0, 0, 0, 0));
@@ -414,7 +580,7 @@ namespace PhotoMode
 				ImGui::PopItemFlag();
 
 				ImGui::SameLine();
-				ImGui::ButtonIcon(MANAGER(Hotkeys)->NextTabKey());
+				ImGui::ButtonIcon(layout.nextTabIcon, false);
 			}
 			ImGui::EndGroup();
 
@@ -475,7 +641,34 @@ namespace PhotoMode
 							resetPlayerTabs = true;
 						}
 
-						characterTab[cachedCharacter->GetFormID()].Draw(resetPlayerTabs);
+						const auto formID = cachedCharacter->GetFormID();
+
+						bool selected = selectedCharacters.contains(formID);
+						if (ImGui::CheckBox("$PM_SelectForGroup"_T, &selected)) {
+							if (selected) {
+								selectedCharacters.insert(formID);
+							} else {
+								selectedCharacters.erase(formID);
+							}
+						}
+
+						// changes to a selected character are applied to the whole selection in the same frame
+						FrameVector<Character*> group{ FrameAllocator() };
+						if (selected) {
+							group.reserve(selectedCharacters.size());
+							for (const auto& id : selectedCharacters) {
+								if (const auto it = characterTab.find(id); it != characterTab.end()) {
+									group.push_back(&it->second);
+								}
+							}
+						} else {
+							group.push_back(&characterTab[formID]);
+						}
+
+						characterTab[formID].Draw(resetPlayerTabs, group);
+						for (const auto& member : group) {
+							member->FlushExpressions();
+						}
 
 						if (resetPlayerTabs) {
 							resetPlayerTabs = false;
@@ -502,72 +695,23 @@ namespace PhotoMode
 
 	void Manager::DrawBar() const
 	{
-		const static auto center = ImGui::GetNativeViewportCenter();
-		const static auto size = ImGui::GetNativeViewportSize();
-
-		const static auto offset = size.y / 20.25f;
-
-		ImGui::SetNextWindowPos(ImVec2(center.x, size.y - offset), ImGuiCond_Always, ImVec2(0.5, 0.5));
+		ImGui::SetNextWindowPos(layout.barPos, ImGuiCond_Always, ImVec2(0.5, 0.5));
 
 		ImGui::Begin("##Bar", nullptr, ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize);  // same offset as control window
 		{
 			ImGui::ExtendWindowPastBorder();
 
-			const static auto takePhotoLabel = "$PM_TAKEPHOTO"_T;
-			const static auto toggleMenusLabel = "$PM_TOGGLEMENUS"_T;
-			const auto        resetLabel = GetResetAll() ? "$PM_RESET_ALL"_T : "$PM_RESET"_T;
-			const static auto freezeTimeLabel = "$PM_FREEZETIME"_T;
-			const static auto drawWeaponsInputLabel = "$PM_DRAWWEAPONSCONTROL"_T;
-
-			const auto& takePhotoIcon = MANAGER(Hotkeys)->TakePhotoIcon();
-			const auto& toggleMenusIcon = MANAGER(Hotkeys)->ToggleMenusIcon();
-			const auto& resetIcon = MANAGER(Hotkeys)->ResetIcon();
-			const auto& freezeTimeIcon = MANAGER(Hotkeys)->FreezeTimeIcon();
-			const auto& drawWeaponsInputIcon = MANAGER(Hotkeys)->DrawWeaponsInputIcon();
-
-			// const static auto togglePMLabel = "$PM_EXIT"_T;
-			// const auto& togglePMIcons = MANAGER(Hotkeys)->TogglePhotoModeIcons();
-
-			// calc total elements width
-			const ImGuiStyle& style = ImGui::GetStyle();
-
-			float width = 0.0f;
-
-			const auto calc_width = [&](const IconFont::IconData* a_icon, const char* a_textLabel) {
-				width += a_icon->size.x;
-				width += style.ItemSpacing.x;
-				width += ImGui::CalcTextSize(a_textLabel).x;
-				width += style.ItemSpacing.x;
-			};
-
-			calc_width(takePhotoIcon, takePhotoLabel);
-			calc_width(toggleMenusIcon, toggleMenusLabel);
-			calc_width(freezeTimeIcon, freezeTimeLabel);
-			calc_width(drawWeaponsInputIcon, drawWeaponsInputLabel);
-			calc_width(resetIcon, resetLabel);
-
-			/*for (const auto& icon : togglePMIcons) {
-				width += icon->size.x;
-			}
-			width += style.ItemSpacing.x;
-			width += ImGui::CalcTextSize(togglePMLabel).x;*/
+			const bool resetAllLabel = GetResetAll();
 
 			// align at center
-			ImGui::AlignForWidth(width);
+			ImGui::AlignForWidth(layout.barWidth + (resetAllLabel ? layout.resetAllExtraWidth : 0.0f));
 
 			// draw
-			constexpr auto draw_button = [](const IconFont::IconData* a_icon, const char* a_textLabel) {
-				ImGui::ButtonIconWithLabel(a_textLabel, a_icon, true);
+			for (std::size_t i = 0; i < layout.barIcons.size(); ++i) {
+				const bool isReset = i == layout.barIcons.size() - 1;
+				ImGui::ButtonIconWithLabel(isReset && resetAllLabel ? layout.resetAllLabel : layout.barLabels[i], layout.barIcons[i], true);
 				ImGui::SameLine();
-			};
-
-			draw_button(takePhotoIcon, takePhotoLabel);
-			draw_button(toggleMenusIcon, toggleMenusLabel);
-			draw_button(freezeTimeIcon, freezeTimeLabel);
-			draw_button(drawWeaponsInputIcon, drawWeaponsInputLabel);
-			draw_button(resetIcon, resetLabel);
-
-			// ImGui::ButtonIconWithLabel(togglePMLabel, togglePMIcons, true);
+			}
 		}
 		ImGui::End();
 	}
@@ -693,4 +837,33 @@ namespace PhotoMode
 
 		return EventResult::kContinue;
 	}
+
+	EventResult Manager::ProcessEvent(const RE::TESContainerChangedEvent* a_evn, RE::BSTEventSource<RE::TESContainerChangedEvent>*)
+	{
+		if (!a_evn || !activated) {
+			return EventResult::kContinue;
+		}
+
+		if (const auto it = characterTab.find(a_evn->oldContainer); it != characterTab.end()) {
+			it->second.OnContainerChanged(a_evn->baseObj, -a_evn->itemCount);
+		}
+		if (const auto it = characterTab.find(a_evn->newContainer); it != characterTab.end()) {
+			it->second.OnContainerChanged(a_evn->baseObj, a_evn->itemCount);
+		}
+
+		return EventResult::kContinue;
+	}
+
+	EventResult Manager::ProcessEvent(const RE::TESEquipEvent* a_evn, RE::BSTEventSource<RE::TESEquipEvent>*)
+	{
+		if (!a_evn || !a_evn->actor || !activated) {
+			return EventResult::kContinue;
+		}
+
+		if (const auto it = characterTab.find(a_evn->actor->GetFormID()); it != characterTab.end()) {
+			it->second.OnEquipChanged(a_evn->baseObject, a_evn->equipped);
+		}
+
+		return EventResult::kContinue;
+	}
 }
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "ImGui/IconsFontAwesome6.h"
+#include "ImGui/IconsFonts.h"
+#include "Input.h"
 
 #include "Tabs/Camera.h"
 #include "Tabs/Character.h"
@@ -12,7 +14,9 @@ namespace PhotoMode
 {
 	class Manager :
 		public ISingleton<Manager>,
-		public RE::BSTEventSink<RE::MenuOpenCloseEvent>
+		public RE::BSTEventSink<RE::MenuOpenCloseEvent>,
+		public RE::BSTEventSink<RE::TESContainerChangedEvent>,
+		public RE::BSTEventSink<RE::TESEquipEvent>
 	{
 	public:
 		static void Register();
@@ -76,12 +80,55 @@ namespace PhotoMode
 		};
 		static constexpr std::array tabResetNotifs = { "$PM_ResetNotifCamera", "$PM_ResetNotifTime", "$PM_ResetNotifPlayer", "$PM_ResetNotifFilters", "$PM_ResetNotifOverlays" };
 
+		// control bar and tab strip metrics, measured again only when one of the key's values changes
+		struct Layout
+		{
+			struct Key
+			{
+				bool operator==(const Key&) const = default;
+
+				// members
+				std::string_view                 language{};
+				Input::TYPE                      inputType{};
+				IconFont::Manager::BUTTON_SCHEME buttonScheme{};
+				float                            viewportWidth{};
+				float                            viewportHeight{};
+				const ImFont*                    font{ nullptr };
+				float                            fontSize{};
+			};
+
+			// members
+			Key  key{};
+			bool valid{ false };
+
+			// control bar, reset is last
+			ImVec2                                   barPos{};
+			float                                    barWidth{};
+			float                                    resetAllExtraWidth{};
+			std::array<const IconFont::IconData*, 5> barIcons{};
+			std::array<const char*, 5>               barLabels{};
+			const char*                              resetAllLabel{ nullptr };
+
+			// control window
+			ImVec2                    controlsPos{};
+			ImVec2                    controlsSize{};
+			const IconFont::IconData* previousTabIcon{ nullptr };
+			const IconFont::IconData* nextTabIcon{ nullptr };
+			float                     tabWidth{ -1.0f };  // measured inside the window, on the first draw after an update
+		};
+
+		static void        CollectForms(ImFontGlyphRangesBuilder& a_builder);
+		static void        BuildFormCatalogues(ImFontGlyphRangesBuilder a_builder);
+		static void        BuildGlyphRanges(ImFontGlyphRangesBuilder& a_builder);
+		void               UpdateLayout();
 		static void        TogglePlayerControls(bool a_enable);
 		void               DrawControls();
 		void               DrawBar() const;
 		[[nodiscard]] bool SetupJournalMenu() const;
 
 		EventResult ProcessEvent(const RE::MenuOpenCloseEvent* a_evn, RE::BSTEventSource<RE::MenuOpenCloseEvent>*) override;
+		EventResult ProcessEvent(const RE::TESContainerChangedEvent* a_evn, RE::BSTEventSource<RE::TESContainerChangedEvent>*) override;
+		EventResult ProcessEvent(const RE::TESEquipEvent* a_evn, RE::BSTEventSource<RE::TESEquipEvent>*) override;
 
 		// members
 		bool activated{ false };
@@ -94,15 +141,18 @@ namespace PhotoMode
 		Camera cameraTab;
 		Time   timeTab;
 
-		Map<RE::FormID, Character> characterTab;
-		RE::Actor*                 cachedCharacter{ nullptr };
-		RE::Actor*                 prevCachedCharacter{ nullptr };
+		Map<RE::FormID, Character>               characterTab;
+		ankerl::unordered_dense::set<RE::FormID> selectedCharacters;  // characters in characterTab that are edited together
+		RE::Actor*                               cachedCharacter{ nullptr };
+		RE::Actor*                               prevCachedCharacter{ nullptr };
 
 		Filters  filterTab;
 		Overlays overlaysTab;
 
 		bool updateKeyboardFocus{ false };
 
+		Layout layout{};
+
 		RE::CameraState originalcameraState{ RE::CameraState::kThirdPerson };
 
 		bool resetWindow{ true };
@@ -121,5 +171,9 @@ namespace PhotoMode
 		bool  openFromPauseMenu{ true };
 
 		RE::TESGlobal* activeGlobal{ nullptr };
+
+		std::future<void>                     formCatalogueTask{};
+		std::chrono::steady_clock::time_point activateTime{};
+		bool                                  firstFrameDrawn{ true };
 	};
 }
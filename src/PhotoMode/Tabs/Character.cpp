@@ -22,22 +22,6 @@ namespace PhotoMode
 			}
 		}
 
-		void Data::Modifier::ApplyModifier(std::uint32_t idx, RE::Actor* a_actor) const
-		{
-			if (const auto faceData = a_actor->GetFaceGenAnimationData()) {
-				RE::BSSpinLockGuard locker(faceData->lock);
-				faceData->modifierKeyFrame.SetValue(idx, static_cast<float>(strength / 100.0f));
-			}
-		}
-
-		void Data::Modifier::ApplyPhenome(std::uint32_t idx, RE::Actor* a_actor) const
-		{
-			if (const auto faceData = a_actor->GetFaceGenAnimationData()) {
-				RE::BSSpinLockGuard locker(faceData->lock);
-				faceData->phenomeKeyFrame.SetValue(idx, static_cast<float>(strength / 100.0f));
-			}
-		}
-
 		void Data::Revert(RE::Actor* a_actor)
 		{
 			if (const auto faceData = a_actor->GetFaceGenAnimationData()) {
@@ -57,6 +41,161 @@ namespace PhotoMode
 			for (std::uint32_t i = 0; i < modifiers.size(); i++) {
 				modifierData[i].strength = 0;
 			}
+
+			dirtyExpression = false;
+			dirtyPhonemes.reset();
+			dirtyModifiers.reset();
+		}
+
+		void Data::ApplyPreset(const Preset& a_preset)
+		{
+			expressionData.modifier = a_preset.expression;
+			expressionData.strength = a_preset.expressionStrength;
+
+			for (std::uint32_t i = 0; i < phonemes.size(); i++) {
+				phonemeData[i].strength = a_preset.phonemeStrengths[i];
+			}
+			for (std::uint32_t i = 0; i < modifiers.size(); i++) {
+				modifierData[i].strength = a_preset.modifierStrengths[i];
+			}
+
+			dirtyExpression = true;
+			dirtyPhonemes.set();
+			dirtyModifiers.set();
+		}
+
+		Preset Data::GetPreset() const
+		{
+			Preset preset{ expressionData.modifier, expressionData.strength };
+
+			for (std::uint32_t i = 0; i < phonemes.size(); i++) {
+				preset.phonemeStrengths[i] = phonemeData[i].strength;
+			}
+			for (std::uint32_t i = 0; i < modifiers.size(); i++) {
+				preset.modifierStrengths[i] = modifierData[i].strength;
+			}
+
+			return preset;
+		}
+
+		void Data::Flush(RE::Actor* a_actor)
+		{
+			if (!dirtyExpression && dirtyPhonemes.none() && dirtyModifiers.none()) {
+				return;
+			}
+
+			if (const auto faceData = a_actor->GetFaceGenAnimationData()) {
+				// expression overrides take the lock themselves
+				if (dirtyExpression) {
+					expressionData.ApplyExpression(a_actor);
+				}
+
+				if (dirtyPhonemes.any() || dirtyModifiers.any()) {
+					RE::BSSpinLockGuard locker(faceData->lock);
+					for (std::uint32_t i = 0; i < phonemes.size(); i++) {
+						if (dirtyPhonemes.test(i)) {
+							faceData->phenomeKeyFrame.SetValue(i, static_cast<float>(phonemeData[i].strength / 100.0f));
+						}
+					}
+					for (std::uint32_t i = 0; i < modifiers.size(); i++) {
+						if (dirtyModifiers.test(i)) {
+							faceData->modifierKeyFrame.SetValue(i, static_cast<float>(modifierData[i].strength / 100.0f));
+						}
+					}
+				}
+			}
+
+			dirtyExpression = false;
+			dirtyPhonemes.reset();
+			dirtyModifiers.reset();
+		}
+
+		void Presets::LoadPresets()
+		{
+			if (loaded) {
+				return;
+			}
+			loaded = true;
+
+			CSimpleIniA ini;
+			ini.SetUnicode();
+			if (ini.LoadFile(presetsPath) < SI_OK) {
+				return;
+			}
+
+			const auto get_values = [&](const char* a_section, const char* a_key, auto& a_values) {
+				const auto values = clib_util::string::split(ini.GetValue(a_section, a_key, ""), ",");
+				for (std::size_t i = 0; i < values.size() && i < a_values.size(); i++) {
+					a_values[i] = std::clamp(clib_util::string::to_num<std::int32_t>(values[i]), 0, 100);
+				}
+			};
+
+			CSimpleIniA::TNamesDepend sections;
+			ini.GetAllSections(sections);
+			sections.sort(CSimpleIniA::Entry::LoadOrder());
+
+			for (const auto& section : sections) {
+				Preset preset{};
+				preset.expression = std::clamp(static_cast<std::int32_t>(ini.GetLongValue(section.pItem, "iExpression", 0)), 0, static_cast<std::int32_t>(expressions.size() - 1));
+				preset.expressionStrength = std::clamp(static_cast<std::int32_t>(ini.GetLongValue(section.pItem, "iExpressionStrength", 0)), 0, 100);
+				get_values(section.pItem, "sPhonemes", preset.phonemeStrengths);
+				get_values(section.pItem, "sModifiers", preset.modifierStrengths);
+
+				names.emplace_back(section.pItem);
+				presets.push_back(preset);
+			}
+
+			logger::info("Loaded {} expression presets", presets.size());
+		}
+
+		void Presets::SavePreset(const Preset& a_preset)
+		{
+			LoadPresets();
+
+			CSimpleIniA ini;
+			ini.SetUnicode();
+			(void)ini.LoadFile(presetsPath);
+
+			std::string name;
+			for (auto i = names.size() + 1; name.empty() || ini.GetSectionSize(name.c_str()) >= 0; i++) {
+				name = fmt::format("Preset {}", i);
+			}
+
+			const auto set_values = [&](const char* a_key, const auto& a_values) {
+				std::string values;
+				for (const auto& value : a_values) {
+					if (!values.empty()) {
+						values += ',';
+					}
+					values += std::to_string(value);
+				}
+				ini.SetValue(name.c_str(), a_key, values.c_str());
+			};
+
+			ini.SetLongValue(name.c_str(), "iExpression", a_preset.expression);
+			ini.SetLongValue(name.c_str(), "iExpressionStrength", a_preset.expressionStrength);
+			set_values("sPhonemes", a_preset.phonemeStrengths);
+			set_values("sModifiers", a_preset.modifierStrengths);
+
+			(void)ini.SaveFile(presetsPath);
+
+			names.push_back(std::move(name));
+			presets.push_back(a_preset);
+		}
+
+		bool Presets::empty() const
+		{
+			return presets.empty();
+		}
+
+		const std::vector<std::string>& Presets::GetNames() const
+		{
+			return names;
+		}
+
+		const Preset& Presets::GetPreset(std::size_t a_index) const
+		{
+			return presets[a_index];
 		}
 	}
 
@@ -86,6 +225,7 @@ namespace PhotoMode
 		} else {
 			characterName = fmt::format("{} [0x{:X}]", a_actor->GetName(), a_actor->GetFormID());
 		}
+		MANAGER(IconFont)->AddGlyphs(characterName);
 
 		//Initiate a list of spells for the character, not the best way to do this but i can't figure out a better way
 		RE::SpellItem* flames = RE::TESForm::LookupByEditorID("Flames")->As<RE::SpellItem>();
@@ -115,12 +255,87 @@ namespace PhotoMode
 		effectShaders.InitForms();
 		effectVFX.InitForms();
 		idles.InitForms();
-		weapons.InitForms(character->GetInventory(), RE::FormType::Weapon);
-		armors.InitForms(character->GetInventory(), RE::FormType::Armor);
+		InitInventory();
 
 		spellsR.InitMagic(SpellList);
 		spellsL.InitMagic(SpellList);
+	}
 
+	void Character::InitInventory()
+	{
+		itemCounts.clear();
+		wornItems.clear();
+
+		const auto inventory = character->GetInventory();
+
+		weapons.InitForms(inventory, RE::FormType::Weapon);
+		armors.InitForms(inventory, RE::FormType::Armor);
+
+		for (const auto& [item, data] : inventory) {
+			if (IsInventoryItem(item) && data.first > 0) {
+				itemCounts[item->GetFormID()] = data.first;
+				if (data.second->IsWorn()) {
+					wornItems.insert(item->GetFormID());
+				}
+			}
+		}
+	}
+
+	void Character::AddSpawnedEffect(RE::ReferenceEffect* a_effect)
+	{
+		if (a_effect) {
+			// effects that ran out on their own don't need reverting
+			std::erase_if(spawnedEffects, [](const auto& a_spawned) { return a_spawned->finished; });
+			spawnedEffects.emplace_back(a_effect);
+		}
+	}
+
+	bool Character::IsInventoryItem(const RE::TESBoundObject* a_item)
+	{
+		return a_item && (a_item->Is(RE::FormType::Weapon) || a_item->Is(RE::FormType::Armor)) && a_item->GetPlayable();
+	}
+
+	void Character::OnContainerChanged(RE::FormID a_baseObj, std::int32_t a_countDelta)
+	{
+		const auto item = RE::TESForm::LookupByID<RE::TESBoundObject>(a_baseObj);
+		if (!IsInventoryItem(item)) {
+			return;
+		}
+
+		auto&      list = item->Is(RE::FormType::Weapon) ? weapons : armors;
+		auto&      count = itemCounts[a_baseObj];
+		const bool owned = count > 0;
+
+		count += a_countDelta;
+
+		if (count > 0) {
+			if (!owned) {
+				// the entry holds the display name of renamed and enchanted items
+				const auto inventory = character->GetInventory([&](const RE::TESBoundObject& a_object) { return &a_object == item; });
+				const auto it = inventory.find(item);
+				list.AddInventoryItem(item, it != inventory.end() ? it->second.second.get() : nullptr);
+			}
+		} else {
+			itemCounts.erase(a_baseObj);
+			wornItems.erase(a_baseObj);
+			if (owned) {
+				list.RemoveForm(item);
+			}
+		}
+	}
+
+	void Character::OnEquipChanged(RE::FormID a_baseObj, bool a_equipped)
+	{
+		// spells, shouts and ammo also send equip events, but only weapons and armor are listed
+		if (!IsInventoryItem(RE::TESForm::LookupByID<RE::TESBoundObject>(a_baseObj))) {
+			return;
+		}
+
+		const bool changed = a_equipped ? wornItems.insert(a_baseObj).second : wornItems.erase(a_baseObj) > 0;
+		if (changed) {
+			// 3D isn't refreshed while the game is paused
+			updateActor = true;
+		}
 	}
 
 	void Character::RevertState()
@@ -150,6 +365,7 @@ namespace PhotoMode
 
 		// reset expressions
 		mfgData.Revert(character);
+		expressionPreset = 0;
 
 		// revert idles
 		idles.Reset();
@@ -158,36 +374,20 @@ namespace PhotoMode
 			idlePlayed = false;
 		}
 
-		//revert inventroy
-		weapons.ResetAndClear();
-		weapons.SetValid(false);
-		armors.ResetAndClear();
-		armors.SetValid(false);
-		spellsR.ResetAndClear();
-		spellsR.SetValid(false);
-		spellsL.ResetAndClear();
-		spellsL.SetValid(false);
-		SpellList.clear();
+		// revert inventory selection, the lists are kept in sync through container events
+		weapons.ResetIndex();
+		armors.ResetIndex();
+		spellsR.ResetIndex();
+		spellsL.ResetIndex();
 
 		// revert effects
 		effectShaders.Reset();
 		effectVFX.Reset();
 
-		if (vfxPlayed || effectsPlayed) {
-			if (const auto processLists = RE::ProcessLists::GetSingleton()) {
-				const auto handle = character->CreateRefHandle();
-				processLists->ForEachMagicTempEffect([&](RE::BSTempEffect& a_effect) {
-					if (const auto referenceEffect = a_effect.As<RE::ReferenceEffect>()) {
-						if (referenceEffect->target == handle) {
-							referenceEffect->finished = true;
-						}
-					}
-					return RE::BSContainer::ForEachResult::kContinue;
-				});
-			}
-			vfxPlayed = false;
-			effectsPlayed = false;
+		for (const auto& effect : spawnedEffects) {
+			effect->finished = true;
 		}
+		spawnedEffects.clear();
 
 		if (!character->IsPlayerRef()) {
 			character->EndInterruptPackage(false);
@@ -199,8 +399,61 @@ namespace PhotoMode
 		return characterName.c_str();
 	}
 
-	void Character::Draw(bool a_resetTabs)
+	void Character::FlushExpressions()
+	{
+		mfgData.Flush(character);
+	}
+
+	void Character::PlayIdle(std::span<Character* const> a_group, RE::TESIdleForm* a_idle)
+	{
+		const auto idleValidity = ImGui::IdleValidity::GetSingleton();
+
+		// each member's own conditions decide, from its cached results if they reach the idle
+		for (const auto& member : a_group) {
+			if (idleValidity->IsValid(member->character, a_idle)) {
+				member->PlayIdle(a_idle);
+			}
+		}
+	}
+
+	void Character::PlayIdle(RE::TESIdleForm* a_idle)
+	{
+		if (idlePlayed) {
+			RevertIdle();
+			idlePlayed = false;
+		}
+		if (const auto currentProcess = character->currentProcess) {
+			if (currentProcess->PlayIdle(character, a_idle, nullptr)) {
+				idlePlayed = true;
+			}
+		}
+	}
+
+	void Character::ApplyEffectShader(RE::TESEffectShader* a_effectShader)
+	{
+		AddSpawnedEffect(character->ApplyEffectShader(a_effectShader));
+	}
+
+	void Character::ApplyVisualEffect(const RE::BGSReferenceEffect* a_vfx)
 	{
+		const bool faceTarget = a_vfx->data.flags.any(RE::BGSReferenceEffect::Flag::kFaceTarget);
+		const bool attachToCamera = a_vfx->data.flags.any(RE::BGSReferenceEffect::Flag::kAttachToCamera);
+
+		if (const auto effectShader = a_vfx->data.effectShader) {
+			AddSpawnedEffect(character->ApplyEffectShader(effectShader, -1, nullptr, faceTarget, attachToCamera));
+		}
+		if (const auto artObject = a_vfx->data.artObject) {
+			AddSpawnedEffect(character->ApplyArtObject(artObject, -1, nullptr, faceTarget, attachToCamera));
+		}
+	}
+
+	void Character::Draw(bool a_resetTabs, std::span<Character* const> a_group)
+	{
+		if (updateActor) {
+			updateActor = false;
+			character->Update(1.0f);
+		}
+
 		if (ImGui::CheckBox(character->IsPlayerRef() ? "$PM_ShowPlayer"_T : "$PM_ShowCharacter"_T, &currentState.visible)) {
 			if (const auto root = character->Get3D()) {
 				root->CullGeometry(!currentState.visible);
@@ -224,6 +477,24 @@ namespace PhotoMode
 					if (ImGui::OpenTabOnHover("$PM_Expressions"_T, a_resetTabs ? ImGuiTabItemFlags_SetSelected : 0)) {
 						using namespace MFG;
 
+						const auto presets = Presets::GetSingleton();
+						presets->LoadPresets();
+
+						if (!presets->empty()) {
+							if (ImGui::EnumSlider("$PM_ExpressionPreset"_T, &expressionPreset, presets->GetNames(), false)) {
+								const auto& preset = presets->GetPreset(expressionPreset);
+								for (const auto& member : a_group) {
+									member->mfgData.ApplyPreset(preset);
+									member->expressionPreset = expressionPreset;
+								}
+							}
+						}
+						if (ImGui::Button("$PM_SaveExpressionPreset"_T)) {
+							presets->SavePreset(mfgData.GetPreset());
+						}
+
+						ImGui::Spacing();
+
 						if (ImGui::EnumSlider("$PM_Expression"_T, &mfgData.expressionData.modifier, expressions)) {
 							mfgData.expressionData.strength = 0;
 						}
@@ -232,7 +503,7 @@ namespace PhotoMode
 							ImGui::BeginDisabled(mfgData.expressionData.modifier == 0);
 							{
 								if (ImGui::Slider("$PM_Intensity"_T, &mfgData.expressionData.strength, 0, 100)) {
-									mfgData.expressionData.ApplyExpression(character);
+									mfgData.SetExpressionDirty();
 								}
 							}
 							ImGui::EndDisabled();
@@ -244,7 +515,7 @@ namespace PhotoMode
 						if (ImGui::TreeNode("$PM_Phoneme"_T)) {
 							for (std::uint32_t i = 0; i < phonemes.size(); i++) {
 								if (ImGui::Slider(TRANSLATE(phonemes[i]), &mfgData.phonemeData[i].strength, 0, 100)) {
-									mfgData.phonemeData[i].ApplyPhenome(i, character);
+									mfgData.SetPhonemeDirty(i);
 								}
 							}
 							ImGui::TreePop();
@@ -253,7 +524,7 @@ namespace PhotoMode
 						if (ImGui::TreeNode("$PM_Modifier"_T)) {
 							for (std::uint32_t i = 0; i < modifiers.size(); i++) {
 								if (ImGui::Slider(TRANSLATE(modifiers[i]), &mfgData.modifierData[i].strength, 0, 100)) {
-									mfgData.modifierData[i].ApplyModifier(i, character);
+									mfgData.SetModifierDirty(i);
 								}
 							}
 							ImGui::TreePop();
@@ -265,15 +536,7 @@ namespace PhotoMode
 				ImGui::SetNextItemWidth(width);
 				if (ImGui::OpenTabOnHover("$PM_Poses"_T)) {
 					idles.GetFormResultFromCombo([&](const auto& a_idle) {
-						if (idlePlayed) {
-							RevertIdle();
-							idlePlayed = false;
-						}
-						if (const auto currentProcess = character->currentProcess) {
-							if (currentProcess->PlayIdle(character, a_idle, nullptr)) {
-								idlePlayed = true;
-							}
-						}
+						PlayIdle(a_group, a_idle);
 					},
 						character);
 					ImGui::EndTabItem();
@@ -290,6 +553,7 @@ namespace PhotoMode
 									AE->UnequipObject(character, a_item);
 								else
 									AE->EquipObject(character, a_item);
+								updateActor = true;
 							}
 						},
 							character);
@@ -298,14 +562,11 @@ namespace PhotoMode
 						armors.GetFormResultFromCombo([&](const auto& a_item) {
 							auto AE = RE::ActorEquipManager::GetSingleton();
 							if (a_item && AE && character) {
-								inventory = character->GetInventory();
-								RE::TESObjectREFR::InventoryItemMap::const_iterator item = inventory.find(a_item);
-								if (item != inventory.end()) {
-									if (item->second.second->IsWorn())
-										AE->UnequipObject(character, a_item, nullptr, 1, a_item->As<RE::TESObjectARMO>()->GetEquipSlot());
-									else
-										AE->EquipObject(character, a_item, nullptr, 1, a_item->As<RE::TESObjectARMO>()->GetEquipSlot());
-								}
+								if (wornItems.contains(a_item->GetFormID()))
+									AE->UnequipObject(character, a_item, nullptr, 1, a_item->As<RE::TESObjectARMO>()->GetEquipSlot());
+								else
+									AE->EquipObject(character, a_item, nullptr, 1, a_item->As<RE::TESObjectARMO>()->GetEquipSlot());
+								updateActor = true;
 							}
 						},
 							character);
@@ -319,6 +580,7 @@ namespace PhotoMode
 									character->DeselectSpell(a_spell);
 								} else
 									RE::ActorEquipManager::GetSingleton()->EquipSpell(character, a_spell, Utils::Slot::GetRightHandSlot());
+								updateActor = true;
 							}
 						},
 							character);
@@ -332,28 +594,25 @@ namespace PhotoMode
 									character->DeselectSpell(a_spell);
 								} else
 									RE::ActorEquipManager::GetSingleton()->EquipSpell(character, a_spell, Utils::Slot::GetLeftHandSlot());
+								updateActor = true;
 							}
 						},
 							character);
 					}
-					character->Update(1.0f);
 					ImGui::EndTabItem();
 				}
 
 				ImGui::SetNextItemWidth(width);
 				if (ImGui::OpenTabOnHover("$PM_Effects"_T)) {
 					effectShaders.GetFormResultFromCombo([&](const auto& a_effectShader) {
-						character->ApplyEffectShader(a_effectShader);
-						effectsPlayed = true;
+						for (const auto& member : a_group) {
+							member->ApplyEffectShader(a_effectShader);
+						}
 					});
 					effectVFX.GetFormResultFromCombo([&](const auto& a_vfx) {
-						if (const auto effectShader = a_vfx->data.effectShader) {
-							character->ApplyEffectShader(effectShader, -1, nullptr, a_vfx->data.flags.any(RE::BGSReferenceEffect::Flag::kFaceTarget), a_vfx->data.flags.any(RE::BGSReferenceEffect::Flag::kAttachToCamera));
-						}
-						if (const auto artObject = a_vfx->data.artObject) {
-							character->ApplyArtObject(artObject, -1, nullptr, a_vfx->data.flags.any(RE::BGSReferenceEffect::Flag::kFaceTarget), a_vfx->data.flags.any(RE::BGSReferenceEffect::Flag::kAttachToCamera));
+						for (const auto& member : a_group) {
+							member->ApplyVisualEffect(a_vfx);
 						}
-						vfxPlayed = true;
 					});
 					ImGui::EndTabItem();
 				}
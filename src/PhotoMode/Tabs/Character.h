@@ -66,11 +66,50 @@ namespace PhotoMode
 			"$PM_HeadYaw"
 		};
 
+		// all 34 values of a face, saved to and loaded from ExpressionPresets.ini
+		struct Preset
+		{
+			std::int32_t                               expression{ 0 };
+			std::int32_t                               expressionStrength{ 0 };
+			std::array<std::int32_t, phonemes.size()>  phonemeStrengths{};
+			std::array<std::int32_t, modifiers.size()> modifierStrengths{};
+		};
+
+		class Presets : public ISingleton<Presets>
+		{
+		public:
+			void LoadPresets();
+			void SavePreset(const Preset& a_preset);
+
+			[[nodiscard]] bool                            empty() const;
+			[[nodiscard]] const std::vector<std::string>& GetNames() const;
+			[[nodiscard]] const Preset&                   GetPreset(std::size_t a_index) const;
+
+		private:
+			static constexpr auto presetsPath{ L"Data/Interface/PhotoMode/ExpressionPresets.ini" };
+
+			// members
+			std::vector<std::string> names{};
+			std::vector<Preset>      presets{};
+			bool                     loaded{ false };
+		};
+
+		// slider changes are only marked dirty, and written to the actor once per frame
 		class Data
 		{
 		public:
 			void Revert(RE::Actor* a_actor);
 
+			void SetExpressionDirty() { dirtyExpression = true; }
+			void SetPhonemeDirty(std::uint32_t a_idx) { dirtyPhonemes.set(a_idx); }
+			void SetModifierDirty(std::uint32_t a_idx) { dirtyModifiers.set(a_idx); }
+
+			void   ApplyPreset(const Preset& a_preset);
+			Preset GetPreset() const;
+
+			// writes all dirty values under a single faceData lock
+			void Flush(RE::Actor* a_actor);
+
 			// members
 			struct Expression
 			{
@@ -81,15 +120,17 @@ namespace PhotoMode
 			};
 			struct Modifier
 			{
-				void ApplyPhenome(std::uint32_t idx, RE::Actor* a_actor) const;
-				void ApplyModifier(std::uint32_t idx, RE::Actor* a_actor) const;
-
 				std::int32_t strength{ 0 };
 			};
 
 			Expression expressionData;
 			Modifier   phonemeData[phonemes.size()]{};
 			Modifier   modifierData[modifiers.size()]{};
+
+		private:
+			bool                          dirtyExpression{ false };
+			std::bitset<phonemes.size()>  dirtyPhonemes{};
+			std::bitset<modifiers.size()> dirtyModifiers{};
 		};
 	}
 
@@ -104,7 +145,13 @@ namespace PhotoMode
 
 		const char* GetName() const;
 
-		void Draw(bool a_resetTabs);
+		// a_group holds every actor that idles, expression presets and effects are applied to, including this one
+		void Draw(bool a_resetTabs, std::span<Character* const> a_group);
+		void FlushExpressions();
+
+		// fed by PhotoMode::Manager while active
+		void OnContainerChanged(RE::FormID a_baseObj, std::int32_t a_countDelta);
+		void OnEquipChanged(RE::FormID a_baseObj, bool a_equipped);
 
 	private:
 		struct State
@@ -119,11 +166,20 @@ namespace PhotoMode
 
 		void RevertIdle() const;
 
+		void        InitInventory();
+		static bool IsInventoryItem(const RE::TESBoundObject* a_item);
+
+		static void PlayIdle(std::span<Character* const> a_group, RE::TESIdleForm* a_idle);
+		void        PlayIdle(RE::TESIdleForm* a_idle);
+		void        ApplyEffectShader(RE::TESEffectShader* a_effectShader);
+		void        ApplyVisualEffect(const RE::BGSReferenceEffect* a_vfx);
+		void        AddSpawnedEffect(RE::ReferenceEffect* a_effect);
+
 		// members
 		RE::Actor*  character{ nullptr };
 		std::string characterName{};
 
-		// names should ideally be pulled from a shared map with different indices for characters but this will do
+		// form names are shared between characters, these only hold the selection
 		ImGui::FormComboBoxFiltered<RE::TESEffectShader>    effectShaders{ "$PM_EffectShaders" };
 		ImGui::FormComboBoxFiltered<RE::TESIdleForm>        idles{ "$PM_Idles" };
 		ImGui::FormComboBoxFiltered<RE::BGSReferenceEffect> effectVFX{ "$PM_VisualEffects" };
@@ -133,8 +189,13 @@ namespace PhotoMode
 		ImGui::FormComboBox<RE::SpellItem>                  spellsL{ "$PM_SpellsL" };
 		std::vector<RE::SpellItem*>                         SpellList;
 
-		RE::TESObjectREFR::InventoryItemMap inventory{};
-		MFG::Data mfgData{};
+		// playable weapons and armors, updated incrementally instead of rebuilding the inventory
+		Map<RE::FormID, std::int32_t>            itemCounts{};
+		ankerl::unordered_dense::set<RE::FormID> wornItems{};
+		bool                                     updateActor{ false };
+
+		MFG::Data    mfgData{};
+		std::int32_t expressionPreset{ 0 };
 
 		State originalState{};
 		State currentState{};
@@ -142,8 +203,9 @@ namespace PhotoMode
 		bool rotationChanged{ false };
 		bool positionChanged{ false };
 
-		bool effectsPlayed{ false };
-		bool vfxPlayed{ false };
+		// shaders/art objects applied from the Effects tab, finished on revert
+		std::vector<RE::NiPointer<RE::ReferenceEffect>> spawnedEffects{};
+
 		bool idlePlayed{ false };
 	};
 
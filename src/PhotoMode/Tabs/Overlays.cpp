@@ -4,11 +4,98 @@
 
 namespace PhotoMode
 {
+	void Overlays::Watcher::Start(const std::filesystem::path& a_folder)
+	{
+		if (thread.joinable()) {
+			return;
+		}
+
+		folder = a_folder;
+		thread = std::jthread([this](std::stop_token a_token) {
+			WatchFolder(a_token);
+		});
+	}
+
+	std::vector<std::filesystem::path> Overlays::Watcher::GetChanges()
+	{
+		std::vector<std::filesystem::path> result;
+
+		std::scoped_lock locker(changesLock);
+		if (!changes.empty()) {
+			result.assign(changes.begin(), changes.end());
+			changes.clear();
+		}
+
+		return result;
+	}
+
+	void Overlays::Watcher::QueueChange(std::filesystem::path a_relativePath)
+	{
+		std::scoped_lock locker(changesLock);
+		changes.emplace(std::move(a_relativePath));
+	}
+
+	void Overlays::Watcher::WatchFolder(const std::stop_token& a_token)
+	{
+		const auto handle = CreateFileW(folder.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+		if (handle == INVALID_HANDLE_VALUE) {
+			logger::error("Unable to watch overlays folder ({})", GetLastError());
+			return;
+		}
+
+		OVERLAPPED overlapped{};
+		overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+
+		constexpr DWORD notifyFilter = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE;
+		alignas(DWORD) std::array<std::byte, 16384> buffer{};
+
+		while (!a_token.stop_requested()) {
+			ResetEvent(overlapped.hEvent);
+			if (!ReadDirectoryChangesW(handle, buffer.data(), static_cast<DWORD>(buffer.size()), TRUE, notifyFilter, nullptr, &overlapped, nullptr)) {
+				break;
+			}
+
+			// wake up periodically so the thread can be stopped
+			DWORD waitResult;
+			do {
+				waitResult = WaitForSingleObject(overlapped.hEvent, 250);
+			} while (waitResult == WAIT_TIMEOUT && !a_token.stop_requested());
+
+			DWORD bytesReturned = 0;
+			if (waitResult != WAIT_OBJECT_0 || !GetOverlappedResult(handle, &overlapped, &bytesReturned, FALSE)) {
+				CancelIo(handle);
+				GetOverlappedResult(handle, &overlapped, &bytesReturned, TRUE);
+				break;
+			}
+
+			// buffer overflowed, rescan everything
+			if (bytesReturned == 0) {
+				QueueChange({});
+				continue;
+			}
+
+			std::size_t offset = 0;
+			while (true) {
+				const auto info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(buffer.data() + offset);
+				QueueChange(std::wstring_view(info->FileName, info->FileNameLength / sizeof(wchar_t)));
+				if (info->NextEntryOffset == 0) {
+					break;
+				}
+				offset += info->NextEntryOffset;
+			}
+		}
+
+		CloseHandle(overlapped.hEvent);
+		CloseHandle(handle);
+	}
+
 	void Overlays::LoadOverlays()
 	{
-		const std::filesystem::path overlaysPath(R"(Data\Interface\PhotoMode\Overlays)");
+		const std::filesystem::path overlaysPath(overlaysFolder);
 
-		if (!std::filesystem::exists(overlaysPath)) {
+		// create the folder so overlays added while the game is running are still picked up
+		if (std::error_code ec; !std::filesystem::exists(overlaysPath, ec) && !std::filesystem::create_directories(overlaysPath, ec)) {
+			logger::error("Unable to create overlays folder ({})", ec.message());
 			return;
 		}
 
@@ -58,6 +145,165 @@ namespace PhotoMode
 				index++;
 			}
 		}
+
+		watcher.Start(overlaysPath);
+	}
+
+	std::pair<std::string, std::string> Overlays::GetOverlayKey(const std::filesystem::path& a_path) const
+	{
+		// keep the category an overlay was filed under on load
+		for (const auto& [folder, files] : overlays) {
+			for (const auto& [fileName, overlay] : files) {
+				if (std::filesystem::path(overlay.path) == a_path) {
+					return { folder, fileName };
+				}
+			}
+		}
+
+		// files in the root folder have no category
+		const auto parentPath = a_path.parent_path();
+		return { parentPath == std::filesystem::path(overlaysFolder) ? std::string() : parentPath.filename().string(), a_path.stem().string() };
+	}
+
+	bool Overlays::AddOverlay(const std::filesystem::path& a_path)
+	{
+		const auto [folder, fileName] = GetOverlayKey(a_path);
+		if (fileName.empty()) {
+			return false;
+		}
+
+		Texture::ImageData imageData(a_path.wstring());
+		if (!imageData.Load(true)) {
+			return false;
+		}
+
+		auto&      files = overlays[folder];
+		const bool isNewFile = !files.contains(fileName);
+		files.insert_or_assign(fileName, imageData);
+
+		if (isNewFile) {
+			auto index = static_cast<std::uint32_t>(std::ranges::find(folders.names, folder) - folders.names.begin());
+			if (index == folders.names.size()) {
+				folders.names.push_back(folder);
+				folderFiles[index].names.push_back("$PM_NONE"_T);
+			}
+			folderFiles[index].names.push_back(fileName);
+		}
+
+		logger::info("{} overlay {}/{}", isNewFile ? "Added" : "Reloaded", folder, fileName);
+
+		return true;
+	}
+
+	void Overlays::RemoveOverlay(const std::string& a_folder, const std::string& a_fileName)
+	{
+		const auto it = overlays.find(a_folder);
+		if (it == overlays.end() || it->second.erase(a_fileName) == 0) {
+			return;
+		}
+
+		const auto folderIt = std::ranges::find(folders.names, a_folder);
+		if (folderIt == folders.names.end()) {
+			return;
+		}
+		const auto folderIndex = static_cast<std::uint32_t>(folderIt - folders.names.begin());
+
+		// 0 is NONE
+		auto& files = folderFiles[folderIndex];
+		if (const auto fileIt = std::find(files.names.begin() + 1, files.names.end(), a_fileName); fileIt != files.names.end()) {
+			const auto fileIndex = static_cast<std::uint32_t>(fileIt - files.names.begin());
+			if (files.index == fileIndex) {
+				files.index = 0;
+			} else if (files.index > fileIndex) {
+				files.index--;
+			}
+			files.names.erase(fileIt);
+		}
+
+		if (it->second.empty()) {
+			overlays.erase(it);
+			folders.names.erase(folderIt);
+
+			// shift the following folders down
+			for (auto index = folderIndex; index < folders.names.size(); ++index) {
+				folderFiles[index] = std::move(folderFiles[index + 1]);
+			}
+			folderFiles.erase(static_cast<std::uint32_t>(folders.names.size()));
+
+			if (folders.index == folderIndex) {
+				folders.index = 0;
+			} else if (folders.index > folderIndex) {
+				folders.index--;
+			}
+		}
+
+		logger::info("Removed overlay {}/{}", a_folder, a_fileName);
+	}
+
+	void Overlays::RescanFolder(const std::filesystem::path& a_path)
+	{
+		// new files
+		std::error_code ec;
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(a_path, ec)) {
+			if (const auto& path = entry.path(); entry.is_regular_file() && path.extension() == ".png") {
+				const auto [folder, fileName] = GetOverlayKey(path);
+				if (const auto folderIt = overlays.find(folder); folderIt == overlays.end() || !folderIt->second.contains(fileName)) {
+					AddOverlay(path);
+				}
+			}
+		}
+
+		// deleted files
+		std::vector<std::pair<std::string, std::string>> missingFiles;
+		for (const auto& [folder, files] : overlays) {
+			for (const auto& [fileName, overlay] : files) {
+				if (!std::filesystem::exists(overlay.path)) {
+					missingFiles.emplace_back(folder, fileName);
+				}
+			}
+		}
+		for (const auto& [folder, fileName] : missingFiles) {
+			RemoveOverlay(folder, fileName);
+		}
+	}
+
+	void Overlays::ProcessChanges()
+	{
+		const auto changes = watcher.GetChanges();
+		if (changes.empty()) {
+			return;
+		}
+
+		const std::filesystem::path overlaysPath(overlaysFolder);
+
+		for (const auto& relativePath : changes) {
+			const auto path = overlaysPath / relativePath;
+
+			std::error_code ec;
+			if (std::filesystem::is_directory(path, ec)) {
+				RescanFolder(path);
+			} else if (path.extension() == ".png") {
+				if (std::filesystem::exists(path, ec)) {
+					AddOverlay(path);
+				} else {
+					const auto [folder, fileName] = GetOverlayKey(path);
+					RemoveOverlay(folder, fileName);
+				}
+			} else if (!path.has_extension() && !std::filesystem::exists(path, ec)) {
+				// deleted/renamed subfolder
+				RescanFolder(overlaysPath);
+			}
+		}
+
+		hasOverlays = !overlays.empty();
+
+		// pointers into the maps may have been invalidated
+		if (hasOverlays && cachedOverlay) {
+			updateOverlay = true;
+		} else {
+			cachedOverlay = nullptr;
+			updateOverlay = false;
+		}
 	}
 
 	void Overlays::RevertOverlays()
@@ -126,6 +372,8 @@ namespace PhotoMode
 		constexpr auto topLeft = ImVec2(0.0f, 0.0f);
 		const auto static bottomRight = ImVec2(size.x, size.y);
 
+		ProcessChanges();
+
 		if (updateOverlay) {
 			updateOverlay = false;
 			cachedOverlay = UpdateOverlay();
@@ -17,7 +17,25 @@ namespace PhotoMode
 		void DrawOverlays();
 
 	private:
-		// members
+		// watches the overlays folder on a background thread and queues changed paths
+		class Watcher
+		{
+		public:
+			void Start(const std::filesystem::path& a_folder);
+
+			std::vector<std::filesystem::path> GetChanges();
+
+		private:
+			void WatchFolder(const std::stop_token& a_token);
+			void QueueChange(std::filesystem::path a_relativePath);
+
+			// members
+			std::filesystem::path           folder{};
+			std::mutex                      changesLock{};
+			std::set<std::filesystem::path> changes{};
+			std::jthread                    thread{};
+		};
+
 		struct FileIndex
 		{
 			const std::string& get_file()
@@ -35,6 +53,15 @@ namespace PhotoMode
 			return folderFiles[folders.index];
 		}
 
+		std::pair<std::string, std::string> GetOverlayKey(const std::filesystem::path& a_path) const;
+
+		void ProcessChanges();
+		void RescanFolder(const std::filesystem::path& a_path);
+		bool AddOverlay(const std::filesystem::path& a_path);
+		void RemoveOverlay(const std::string& a_folder, const std::string& a_fileName);
+
+		static constexpr std::string_view overlaysFolder{ R"(Data\Interface\PhotoMode\Overlays)" };
+
 		// folder, file
 		StringMap<StringMap<Texture::ImageData>> overlays{};
 		Texture::ImageData*                      cachedOverlay{ nullptr };
@@ -45,5 +72,7 @@ namespace PhotoMode
 		Map<std::uint32_t, FileIndex> folderFiles{};
 
 		float alpha{ 1.0f };
+
+		Watcher watcher{};
 	};
 }
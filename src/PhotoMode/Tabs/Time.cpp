@@ -71,7 +71,14 @@ namespace PhotoMode
 		ImGui::Dummy({ 0, 5 });
 
 		auto& gameHour = RE::Calendar::GetSingleton()->gameHour->value;
-		ImGui::Slider("$PM_GameHour"_T, &gameHour, 0.0f, 23.99f, std::format("{:%I:%M %p}", std::chrono::duration<float, std::ratio<3600>>(gameHour)).c_str(), ImGuiSliderFlags_AlwaysClamp | ImGuiSliderFlags_NoInput);
+
+		// hh:mm AM/PM, formatted into a stack buffer every frame
+		const auto           minutes = static_cast<std::int32_t>(gameHour * 60.0f);
+		const auto           hour = minutes / 60 % 24;
+		std::array<char, 16> gameHourText{};
+		std::format_to_n(gameHourText.data(), gameHourText.size() - 1, "{:02}:{:02} {}", hour % 12 == 0 ? 12 : hour % 12, minutes % 60, hour < 12 ? "AM" : "PM");
+
+		ImGui::Slider("$PM_GameHour"_T, &gameHour, 0.0f, 23.99f, gameHourText.data(), ImGuiSliderFlags_AlwaysClamp | ImGuiSliderFlags_NoInput);
 
 		if (ImGui::DragOnHover("$PM_TimeScaleMult"_T, &currentTimescaleMult, 10, 1.0f, 1000.0f, "%.fX")) {
 			RE::Calendar::GetSingleton()->timeScale->value = originalState.timescale * currentTimescaleMult;
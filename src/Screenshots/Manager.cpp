@@ -21,6 +21,11 @@ namespace Screenshot
 		paintFilter.radius = a_ini.GetLongValue("Screenshots", "iPaintRadius", paintFilter.radius);
 
 		compressTextures = a_ini.GetBoolValue("Screenshots", "bCompressTextures", compressTextures);
+
+		// clamped to the MCM slider ranges
+		burst.shotsPerSecond = std::clamp(static_cast<float>(a_ini.GetDoubleValue("Screenshots", "fBurstShotsPerSecond", burst.shotsPerSecond)), 1.0f, 30.0f);
+		burst.maxShots = static_cast<std::uint32_t>(std::clamp<long>(a_ini.GetLongValue("Screenshots", "iBurstMaxShots", burst.maxShots), 1, 100));
+		burst.maxQueuedExports = static_cast<std::uint32_t>(std::clamp<long>(a_ini.GetLongValue("Screenshots", "iMaxQueuedExports", burst.maxQueuedExports), 1, 8));
 	}
 
 	void Manager::LoadScreenshotTextures()
@@ -72,6 +77,7 @@ namespace Screenshot
 
 	void Manager::AddScreenshotPaths(Paths& a_paths)
 	{
+		std::scoped_lock lock(pathsLock);
 		screenshots.push_back(Texture::Sanitize(a_paths.screenshot));
 		paintings.push_back(Texture::Sanitize(a_paths.painting));
 	}
@@ -103,6 +109,7 @@ namespace Screenshot
 
 	bool Manager::CanDisplayScreenshotInLoadScreen() const
 	{
+		std::scoped_lock lock(pathsLock);
 		return takeScreenshotAsDDS && (!screenshots.empty() || !paintings.empty());
 	}
 
@@ -118,58 +125,181 @@ namespace Screenshot
 			return false;
 		}
 
-		bool skipVanillaScreenshot = false;
-
-		// capture screenshot
-		DirectX::ScratchImage inputImage;
+		// capture screenshot, everything after that happens on the export thread
+		ExportJob job{};
 
 		const ComPtr<ID3D11Device>        device{ renderer->forwarder };
 		const ComPtr<ID3D11DeviceContext> deviceContext{ renderer->context };
-		DirectX::CaptureTexture(device.Get(), deviceContext.Get(), a_texture_2d, inputImage);
+		if (FAILED(DirectX::CaptureTexture(device.Get(), deviceContext.Get(), a_texture_2d, job.image))) {
+			return false;
+		}
 
-		// apply overlay
+		// overlays are saved as png by the export thread instead of the game
 		if (const auto [overlay, alpha] = MANAGER(PhotoMode)->GetOverlay(); overlay) {
-			DirectX::ScratchImage overlayImage;
-			DirectX::ScratchImage blendedImage;
+			job.path = a_path;
+			job.overlay = overlay->image;
+			job.overlayAlpha = alpha;
+		}
 
-			// Convert PNG B8G8R8 format to R8G8B8
-			DirectX::Convert(overlay->image->GetImages(), 1,
-				overlay->image->GetMetadata(),
-				inputImage.GetMetadata().format, DirectX::TEX_FILTER_DEFAULT, DirectX::TEX_THRESHOLD_DEFAULT,
-				overlayImage);
+		if (const auto& metadata = job.image.GetMetadata(); takeScreenshotAsDDS && metadata.width % 4 == 0 && metadata.height % 4 == 0) {
+			job.index = GetIndex();
+			IncrementIndex();
+		}
 
-			Texture::AlphaBlendImage(inputImage.GetImages(), overlayImage.GetImages(), blendedImage, alpha);
+		// settings can be reloaded from the MCM while the job is queued
+		job.compressTextures = compressTextures;
+		if (applyPaintFilter) {
+			job.paintFilter = paintFilter;
+		}
 
-			TakeScreenshotAsTexture(blendedImage, inputImage);
-			Texture::SaveToPNG(blendedImage, a_path);
+		const bool skipVanillaScreenshot = job.overlay != nullptr;
+		if (job.overlay || job.index) {
+			// before the export thread starts, which is the only one to use it afterwards
+			if (!exportThread.joinable()) {
+				CreateExportDevice(device.Get());
+			}
+			QueueExport(std::move(job));
+		}
 
-			overlayImage.Release();
-			blendedImage.Release();
+		return skipVanillaScreenshot;
+	}
 
-			skipVanillaScreenshot = true;
-		} else {
-			TakeScreenshotAsTexture(inputImage, inputImage);
+	bool Manager::QueueBurstShot()
+	{
+		const auto now = std::chrono::steady_clock::now();
+
+		if (!burst.active) {
+			burst.active = true;
+			burst.shots = 0;
+			burst.deferred = 0;
 		}
 
-		inputImage.Release();
+		if (burst.shots >= burst.maxShots) {
+			return false;
+		}
+		if (burst.shots > 0 && burst.shotsPerSecond > 0.0f && now - burst.lastShot < std::chrono::duration<float>(1.0f / burst.shotsPerSecond)) {
+			return false;
+		}
+		// the shot is due, but wait for the exports instead of piling up captures
+		if (pendingExports.load() >= burst.maxQueuedExports) {
+			++burst.deferred;
+			return false;
+		}
 
-		return skipVanillaScreenshot;
+		if (burst.shots == 0) {
+			burst.start = now;
+		}
+		burst.lastShot = now;
+		++burst.shots;
+
+		return true;
 	}
 
-	void Manager::TakeScreenshotAsTexture(const DirectX::ScratchImage& a_ssImage, const DirectX::ScratchImage& a_paintingImage)
+	void Manager::EndBurst()
 	{
-		if (!takeScreenshotAsDDS || a_ssImage.GetMetadata().width % 4 != 0 || a_ssImage.GetMetadata().height % 4 != 0) {
+		if (!burst.active) {
 			return;
 		}
+		burst.active = false;
 
-		Paths      ssPaths(GetIndex());
-		const auto renderer = RE::BSGraphics::Renderer::GetSingleton();
+		if (burst.shots == 0) {
+			return;
+		}
+
+		const auto seconds = std::chrono::duration<float>(burst.lastShot - burst.start).count();
+		const auto achieved = seconds > 0.0f ? (burst.shots - 1) / seconds : 0.0f;
+
+		logger::info("Burst capture: {} shots in {:.2f}s, {:.2f} shots/s (target {:.2f}), {} frames deferred by exports",
+			burst.shots, seconds, achieved, burst.shotsPerSecond, burst.deferred);
+	}
+
+	void Manager::CreateExportDevice(ID3D11Device* a_gameDevice)
+	{
+		ComPtr<IDXGIDevice>  dxgiDevice;
+		ComPtr<IDXGIAdapter> adapter;
+		if (FAILED(a_gameDevice->QueryInterface(IID_PPV_ARGS(&dxgiDevice))) || FAILED(dxgiDevice->GetAdapter(&adapter))) {
+			logger::warn("Failed to get the game's adapter, compressing screenshots on the CPU");
+			return;
+		}
+
+		constexpr D3D_FEATURE_LEVEL featureLevel{ D3D_FEATURE_LEVEL_11_0 };
+		if (FAILED(D3D11CreateDevice(adapter.Get(), D3D_DRIVER_TYPE_UNKNOWN, nullptr, 0, &featureLevel, 1, D3D11_SDK_VERSION, &exportDevice, nullptr, nullptr))) {
+			logger::warn("Failed to create export device, compressing screenshots on the CPU");
+		}
+	}
+
+	void Manager::QueueExport(ExportJob a_job)
+	{
+		if (!exportThread.joinable()) {
+			exportThread = std::jthread([this](const std::stop_token& a_token) { ProcessExports(a_token); });
+		}
+
+		++pendingExports;
+		{
+			std::scoped_lock lock(exportLock);
+			exportQueue.push_back(std::move(a_job));
+		}
+		exportCondition.notify_one();
+	}
+
+	void Manager::ProcessExports(const std::stop_token& a_token)
+	{
+		// SaveToWICFile (PNG overlays) needs COM on this thread
+		const auto comResult = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+		while (true) {
+			ExportJob job{};
+			{
+				std::unique_lock lock(exportLock);
+				if (!exportCondition.wait(lock, a_token, [this] { return !exportQueue.empty(); })) {
+					break;
+				}
+				job = std::move(exportQueue.front());
+				exportQueue.pop_front();
+			}
+
+			Export(job);
+			--pendingExports;
+		}
+
+		if (SUCCEEDED(comResult)) {
+			CoUninitialize();
+		}
+	}
+
+	void Manager::Export(const ExportJob& a_job)
+	{
+		// apply overlay
+		if (a_job.overlay) {
+			DirectX::ScratchImage overlayImage;
+			DirectX::ScratchImage blendedImage;
+
+			// Convert PNG B8G8R8 format to R8G8B8
+			DirectX::Convert(a_job.overlay->GetImages(), 1,
+				a_job.overlay->GetMetadata(),
+				a_job.image.GetMetadata().format, DirectX::TEX_FILTER_DEFAULT, DirectX::TEX_THRESHOLD_DEFAULT,
+				overlayImage);
+
+			Texture::AlphaBlendImage(a_job.image.GetImages(), overlayImage.GetImages(), blendedImage, a_job.overlayAlpha);
+
+			if (a_job.index) {
+				TakeScreenshotAsTexture(blendedImage, a_job.image, a_job);
+			}
+			Texture::SaveToPNG(blendedImage, a_job.path);
+		} else if (a_job.index) {
+			TakeScreenshotAsTexture(a_job.image, a_job.image, a_job);
+		}
+	}
+
+	void Manager::TakeScreenshotAsTexture(const DirectX::ScratchImage& a_ssImage, const DirectX::ScratchImage& a_paintingImage, const ExportJob& a_job)
+	{
+		Paths ssPaths(*a_job.index);
 
 		// regular
-		if (compressTextures) {
+		if (a_job.compressTextures) {
 			DirectX::ScratchImage outputImage;
 
-			Texture::CompressTexture(renderer, a_ssImage, outputImage);
+			Texture::CompressTexture(exportDevice.Get(), a_ssImage, outputImage);
 			Texture::SaveToDDS(outputImage, ssPaths.screenshot);
 
 			outputImage.Release();
@@ -178,13 +308,13 @@ namespace Screenshot
 		}
 
 		// painting
-		if (applyPaintFilter) {
+		if (a_job.paintFilter) {
 			DirectX::ScratchImage outputImage;
-			Texture::OilPaintingFilter(a_paintingImage.GetImages(), paintFilter.radius, paintFilter.intensity, outputImage);
+			Texture::OilPaintingFilter(a_paintingImage.GetImages(), a_job.paintFilter->radius, a_job.paintFilter->intensity, outputImage);
 
-			if (compressTextures) {
+			if (a_job.compressTextures) {
 				DirectX::ScratchImage compressedImage;
-				Texture::CompressTexture(renderer, outputImage, compressedImage);  // NOLINT(readability-suspicious-call-argument)
+				Texture::CompressTexture(exportDevice.Get(), outputImage, compressedImage);
 				Texture::SaveToDDS(compressedImage, ssPaths.painting);
 				compressedImage.Release();
 			} else {
@@ -194,12 +324,12 @@ namespace Screenshot
 			outputImage.Release();
 		}
 
-		IncrementIndex();
 		AddScreenshotPaths(ssPaths);
 	}
 
 	std::string Manager::GetRandomScreenshot()
 	{
+		std::scoped_lock lock(pathsLock);
 		if (screenshots.empty()) {
 			return {};
 		}
@@ -210,10 +340,13 @@ namespace Screenshot
 	std::string Manager::GetRandomPainting()
 	{
 		// fallback to screenshots
-		if (paintings.empty() || !MANAGER(Screenshot)->CanApplyPaintFilter()) {
-			return GetRandomScreenshot();
+		{
+			std::scoped_lock lock(pathsLock);
+			if (!paintings.empty() && MANAGER(Screenshot)->CanApplyPaintFilter()) {
+				return paintings[RNG().Generate<std::size_t>(0, paintings.size() - 1)];
+			}
 		}
 
-		return paintings[RNG().Generate<std::size_t>(0, paintings.size() - 1)];
+		return GetRandomScreenshot();
 	}
 }
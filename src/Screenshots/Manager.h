@@ -21,6 +21,10 @@ namespace Screenshot
 
 		bool TakeScreenshot(ID3D11Texture2D* a_texture_2d, const char* a_path);
 
+		// held take photo key, true if a burst shot should be captured now
+		bool QueueBurstShot();
+		void EndBurst();
+
 		std::uint32_t GetIndex() const;
 		void          IncrementIndex();
 
@@ -33,8 +37,32 @@ namespace Screenshot
 		bool CanApplyPaintFilter() const;
 
 	private:
+		struct PaintFilter
+		{
+			std::int32_t radius{ 4 };
+			float        intensity{ 30.0f };
+		};
+
+		// captured frame, filtered, compressed and saved on the export thread
+		struct ExportJob
+		{
+			// members
+			DirectX::ScratchImage                  image;
+			std::string                            path;
+			std::shared_ptr<DirectX::ScratchImage> overlay;
+			float                                  overlayAlpha;
+			std::optional<std::uint32_t>           index;  // of the DDS textures, if saved
+			bool                                   compressTextures;
+			std::optional<PaintFilter>             paintFilter;  // if applied
+		};
+
+		void CreateExportDevice(ID3D11Device* a_gameDevice);
+		void QueueExport(ExportJob a_job);
+		void ProcessExports(const std::stop_token& a_token);
+		void Export(const ExportJob& a_job);
+
 		void AddScreenshotPaths(Paths& a_paths);
-		void TakeScreenshotAsTexture(const DirectX::ScratchImage& a_ssImage, const DirectX::ScratchImage& a_paintingImage);
+		void TakeScreenshotAsTexture(const DirectX::ScratchImage& a_ssImage, const DirectX::ScratchImage& a_paintingImage, const ExportJob& a_job);
 
 		// members
 		std::vector<std::string> screenshots{};
@@ -44,14 +72,32 @@ namespace Screenshot
 		bool takeScreenshotAsDDS{ true };
 		bool compressTextures{ true };
 
-		bool applyPaintFilter{ true };
-		struct
-		{
-			std::int32_t radius{ 4 };
-			float        intensity{ 30.0f };
-		} paintFilter;
+		bool        applyPaintFilter{ true };
+		PaintFilter paintFilter{};
 
 		bool allowMultiScreenshots{ true };
 		bool autoHideMenus{ true };
+
+		// burst capture, while the take photo key is held
+		struct
+		{
+			float         shotsPerSecond{ 4.0f };
+			std::uint32_t maxShots{ 30 };
+			std::uint32_t maxQueuedExports{ 2 };  // shots are deferred while this many are being exported
+
+			bool                                  active{ false };
+			std::chrono::steady_clock::time_point start{};
+			std::chrono::steady_clock::time_point lastShot{};
+			std::uint32_t                         shots{ 0 };
+			std::uint32_t                         deferred{ 0 };
+		} burst;
+
+		mutable std::mutex          pathsLock{};  // screenshots and paintings are added by the export thread
+		std::mutex                  exportLock{};
+		std::condition_variable_any exportCondition{};
+		std::deque<ExportJob>       exportQueue{};
+		std::atomic<std::uint32_t>  pendingExports{ 0 };  // queued or being exported
+		ComPtr<ID3D11Device>        exportDevice{};  // BC7 encoder, on the game's adapter but only used by the export thread
+		std::jthread                exportThread{};
 	};
 }
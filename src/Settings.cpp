@@ -3,6 +3,7 @@
 #include "ImGui/IconsFonts.h"
 #include "ImGui/Renderer.h"
 #include "Input.h"
+#include "InputRecorder.h"
 #include "PhotoMode/Hotkeys.h"
 #include "PhotoMode/Manager.h"
 #include "Screenshots/LoadScreen.h"
@@ -53,6 +54,7 @@ void Settings::LoadMCMSettings() const
 
 		MANAGER(IconFont)->LoadMCMSettings(ini);  // button scheme
 		MANAGER(Input)->LoadMCMSettings(ini);     // key held duration
+		MANAGER(InputRecorder)->LoadMCMSettings(ini);
 
 		MANAGER(PhotoMode)->LoadMCMSettings(ini);
 	};
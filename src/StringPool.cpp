@@ -0,0 +1,35 @@
+#include "StringPool.h"
+
+std::string_view StringPool::Intern(std::string_view a_str)
+{
+	std::scoped_lock locker(lock);
+
+	if (const auto it = strings.find(a_str); it != strings.end()) {
+		return *it;
+	}
+
+	const auto str = Allocate(a_str);
+	strings.insert(str);
+
+	return str;
+}
+
+std::string_view StringPool::Allocate(std::string_view a_str)
+{
+	const auto size = a_str.size() + 1;
+	if (size > remaining) {
+		const auto newBlockSize = std::max(size, blockSize);
+		blocks.push_back(std::make_unique_for_overwrite<char[]>(newBlockSize));
+		cursor = blocks.back().get();
+		remaining = newBlockSize;
+	}
+
+	std::memcpy(cursor, a_str.data(), a_str.size());
+	cursor[a_str.size()] = '\0';
+
+	const std::string_view str{ cursor, a_str.size() };
+	cursor += size;
+	remaining -= size;
+
+	return str;
+}
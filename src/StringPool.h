@@ -0,0 +1,21 @@
+#pragma once
+
+// Append-only, deduplicated storage for strings that live until the game exits (EditorIDs, names, translations).
+// Strings are packed into large blocks instead of being allocated one by one, and stay null-terminated.
+class StringPool final : public ISingleton<StringPool>
+{
+public:
+	std::string_view Intern(std::string_view a_str);
+
+private:
+	std::string_view Allocate(std::string_view a_str);
+
+	static constexpr std::size_t blockSize{ 256 * 1024 };
+
+	// members
+	std::mutex                                     lock{};
+	std::vector<std::unique_ptr<char[]>>           blocks{};
+	char*                                          cursor{ nullptr };
+	std::size_t                                    remaining{ 0 };
+	ankerl::unordered_dense::set<std::string_view> strings{};
+};
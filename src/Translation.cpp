@@ -2,6 +2,12 @@
 
 namespace Translation
 {
+	std::vector<std::string_view>& GetLiteralKeys()
+	{
+		static std::vector<std::string_view> keys;
+		return keys;
+	}
+
 	std::string Manager::GetGameLanguage()
 	{
 		const auto iniSettingCollection = RE::INISettingCollection::GetSingleton();
@@ -12,47 +18,145 @@ namespace Translation
 
 	void Manager::BuildTranslationMap()
 	{
-		std::filesystem::path path{ fmt::format(R"(Data\Interface\Translations\PhotoMode_{}.txt)", GetGameLanguage()) };
+		auto gameLanguage = GetGameLanguage();
+
+		std::filesystem::path path{ fmt::format(R"(Data\Interface\Translations\PhotoMode_{}.txt)", gameLanguage) };
 
 		if (!LoadTranslation(path)) {
 			LoadTranslation(R"(Data\Interface\Translations\PhotoMode_ENGLISH.txt)"sv);
+			gameLanguage = "ENGLISH"s;
 		}
+
+		language = StringPool::GetSingleton()->Intern(gameLanguage);
+
+		BuildLookupTable();
+		ReportMissingKeys();
 	}
 
-	bool Manager::LoadTranslation(const std::filesystem::path& a_path)
+	void Manager::BuildLookupTable()
 	{
-		if (!std::filesystem::exists(a_path)) {
-			return false;
+		if (translationMap.empty()) {
+			table.clear();
+			return;
 		}
 
-		std::wfstream filestream(a_path, std::wfstream::in | std::wfstream::binary);
-		if (!filestream.good()) {
-			return false;
-		} else {
-			logger::info("Reading translations from {}...", a_path.string());
+		// a power of two with at least twice as many slots as keys
+		const auto bits = static_cast<std::uint32_t>(std::bit_width(translationMap.size() * 2 - 1));
+		shift = 64 - bits;
+		mask = (std::size_t(1) << bits) - 1;
+		table.assign(mask + 1, {});
+
+		for (const auto& [key, value] : translationMap) {
+			const auto hash = HashKey(key);
+
+			auto i = GetSlot(hash);
+			for (; table[i].value.data(); i = (i + 1) & mask) {
+				// the keys are distinct, so only a 64-bit hash collision gets here
+				if (table[i].hash == hash) {
+					logger::error("Translation keys {} and another share a hash, falling back to map lookups", key);
+					table.clear();
+					return;
+				}
+			}
+			table[i] = { hash, value };
+		}
+
+		logger::info("Built translation table ({} keys, {} slots)", translationMap.size(), table.size());
+	}
+
+	void Manager::ReportMissingKeys() const
+	{
+		auto& keys = GetLiteralKeys();
+
+		std::ranges::sort(keys);
+		const auto [first, last] = std::ranges::unique(keys);
+		keys.erase(first, last);
+
+		for (const auto& key : keys) {
+			if (!translationMap.contains(key)) {
+				logger::warn("Missing translation for {}", key);
+			}
+		}
+	}
+
+	std::string_view Manager::GetLanguage() const
+	{
+		return language;
+	}
+
+	MappedFile::MappedFile(const std::filesystem::path& a_path)
+	{
+		file = CreateFileW(a_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE) {
+			return;
+		}
+
+		LARGE_INTEGER fileSize{};
+		if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+			return;
 		}
 
-		filestream.imbue(std::locale(filestream.getloc(), new std::codecvt_utf16<wchar_t, 0x10FFFF, std::little_endian>));
+		mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mapping) {
+			return;
+		}
+
+		if (const auto view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)) {
+			bytes = { static_cast<const std::byte*>(view), static_cast<std::size_t>(fileSize.QuadPart) };
+		}
+	}
 
-		// check if the BOM is UTF-16
-		constexpr wchar_t BOM_UTF16LE = 0xFEFF;
-		if (filestream.get() != BOM_UTF16LE) {
-			logger::info("BOM Error, file must be encoded in UCS-2 LE.");
+	MappedFile::~MappedFile()
+	{
+		if (!bytes.empty()) {
+			UnmapViewOfFile(bytes.data());
+		}
+		if (mapping) {
+			CloseHandle(mapping);
+		}
+		if (file != INVALID_HANDLE_VALUE) {
+			CloseHandle(file);
+		}
+	}
+
+	bool Manager::LoadTranslation(const std::filesystem::path& a_path)
+	{
+		const MappedFile mappedFile(a_path);
+		const auto       bytes = mappedFile.GetBytes();
+		if (bytes.empty()) {
 			return false;
 		}
 
-		std::wstring line, key, value;
+		logger::info("Reading translations from {}...", a_path.string());
 
-		while (std::getline(filestream, line)) {
-			std::wstringstream ss(line);
-			ss >> key;
-			// remove leading whitespace
-			std::getline(ss >> std::ws, value);
-			// remove space/new line at end
-			if (std::isspace(value.back())) {
-				value.pop_back();
+		const auto fileHash = HashKey({ reinterpret_cast<const char*>(bytes.data()), bytes.size() });
+		const auto cachePath = std::filesystem::path(cacheFolder) / a_path.filename().replace_extension(".bin");
+
+		File loaded;
+		switch (loaded.LoadCache(cachePath, fileHash)) {
+		case File::CacheResult::kLoaded:
+			logger::info("Loaded {} translations from {}", loaded.GetEntries().size(), cachePath.string());
+			break;
+		case File::CacheResult::kCorrupt:
+			logger::warn("Translation cache {} is corrupt, parsing the translation instead", cachePath.string());
+			[[fallthrough]];
+		case File::CacheResult::kMissing:
+			// the view is page aligned
+			if (!loaded.Parse(bytes)) {
+				logger::info("BOM Error, file must be encoded in UCS-2 LE.");
+				return false;
+			}
+			if (!loaded.SaveCache(cachePath, fileHash)) {
+				logger::warn("Unable to write translation cache {}", cachePath.string());
 			}
-			translationMap.emplace(*stl::utf16_to_utf8(key), *stl::utf16_to_utf8(value));
+			break;
+		}
+
+		file = std::move(loaded);
+
+		translationMap.clear();
+		for (const auto& [key, value] : file.GetEntries()) {
+			translationMap.emplace(key, value);
 		}
 
 		return true;
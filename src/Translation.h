@@ -1,7 +1,65 @@
 #pragma once
 
+#include "TranslationFile.h"
+
 namespace Translation
 {
+	struct Key
+	{
+		constexpr Key(std::string_view a_key) :
+			hash(HashKey(a_key)),
+			str(a_key)
+		{}
+		constexpr Key(std::uint64_t a_hash, std::string_view a_key) :
+			hash(a_hash),
+			str(a_key)
+		{}
+
+		// members
+		std::uint64_t    hash;
+		std::string_view str;
+	};
+
+	// "$PM_..."_T keys, hashed at compile time
+	template <std::size_t N>
+	struct KeyLiteral
+	{
+		consteval KeyLiteral(const char (&a_str)[N])
+		{
+			std::copy_n(a_str, N, str);
+			hash = HashKey({ str, N - 1 });
+		}
+
+		// members
+		char          str[N]{};
+		std::uint64_t hash{};
+	};
+
+	// literal keys used by the plugin, registered before main so missing translations can be reported on load
+	std::vector<std::string_view>& GetLiteralKeys();
+
+	template <KeyLiteral K>
+	inline const bool registeredKey = (GetLiteralKeys().emplace_back(K.str, sizeof(K.str) - 1), true);
+
+	// read-only view of a whole file
+	class MappedFile
+	{
+	public:
+		MappedFile(const std::filesystem::path& a_path);
+		MappedFile(const MappedFile&) = delete;
+		~MappedFile();
+
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		std::span<const std::byte> GetBytes() const { return bytes; }
+
+	private:
+		// members
+		HANDLE                     file{ INVALID_HANDLE_VALUE };
+		HANDLE                     mapping{ nullptr };
+		std::span<const std::byte> bytes{};
+	};
+
 	class Manager final : public ISingleton<Manager>
 	{
 	public:
@@ -10,26 +68,71 @@ namespace Translation
 		void BuildTranslationMap();
 		bool LoadTranslation(const std::filesystem::path& a_path);
 
-		template <class T>
-		const std::string& GetTranslation(const T& a_key)
+		std::string_view GetLanguage() const;
+
+		// UTF-8 keys and values of the loaded file, null-separated
+		std::span<const char> GetText() const { return file.GetText(); }
+
+		// translations are null-terminated
+		std::string_view GetTranslation(const Key& a_key) const
 		{
-			if (const auto it = translationMap.find(a_key); it != translationMap.end()) {
+			if (!table.empty()) {
+				// the table is at most half full, so probing always reaches an empty slot
+				for (auto i = GetSlot(a_key.hash); table[i].value.data(); i = (i + 1) & mask) {
+					if (table[i].hash == a_key.hash) {
+						return table[i].value;
+					}
+				}
+			} else if (const auto it = translationMap.find(a_key.str); it != translationMap.end()) {
 				return it->second;
 			}
 
-			static std::string str = "TRANSLATION FAILED";
-			return str;
+			return "TRANSLATION FAILED"sv;
+		}
+		std::string_view GetTranslation(std::string_view a_key) const
+		{
+			return GetTranslation(Key(a_key));
 		}
 
 	private:
-		StringMap<std::string> translationMap{};
+		struct Slot
+		{
+			// members
+			std::uint64_t    hash{ 0 };
+			std::string_view value{};
+		};
+
+		// open addressing with linear probing over at least twice as many slots as keys, comparing the stored 64-bit hashes
+		void BuildLookupTable();
+		void ReportMissingKeys() const;
+
+		// multiply-shift, FNV-1a's low bits alone are poorly mixed
+		std::size_t GetSlot(std::uint64_t a_hash) const
+		{
+			return static_cast<std::size_t>((a_hash * 0x9E3779B97F4A7C15) >> shift);
+		}
+
+		static constexpr auto cacheFolder{ R"(Data\SKSE\Plugins\PhotoMode\Cache)" };
+
+		// members
+		File                                    file{};  // translationMap points into its text
+		Map<std::string_view, std::string_view> translationMap{};
+		std::string_view                        language{};  // of the loaded file
+
+		std::vector<Slot> table{};  // empty slots have no value
+		std::size_t       mask{ 0 };
+		std::uint32_t     shift{ 63 };
 	};
 }
 
-#define TRANSLATE(STR) Translation::Manager::GetSingleton()->GetTranslation(STR).c_str()
+#define TRANSLATE(STR) Translation::Manager::GetSingleton()->GetTranslation(STR).data()
 #define TRANSLATE_S(STR) Translation::Manager::GetSingleton()->GetTranslation(STR)
 
-constexpr const char* operator""_T(const char* str, std::size_t)
+template <Translation::KeyLiteral K>
+const char* operator""_T()
 {
-	return Translation::Manager::GetSingleton()->GetTranslation(str).c_str();
+	(void)Translation::registeredKey<K>;
+
+	static constexpr Translation::Key key{ K.hash, std::string_view{ K.str, sizeof(K.str) - 1 } };
+	return Translation::Manager::GetSingleton()->GetTranslation(key).data();
 }
@@ -0,0 +1,164 @@
+#include "TranslationFile.h"
+
+namespace Translation
+{
+	bool File::Parse(std::span<const std::byte> a_bytes)
+	{
+		// check if the BOM is UTF-16
+		if (a_bytes.size() < 2 || a_bytes[0] != std::byte{ 0xFF } || a_bytes[1] != std::byte{ 0xFE }) {
+			return false;
+		}
+
+		const std::u16string_view content{ reinterpret_cast<const char16_t*>(a_bytes.data() + 2), (a_bytes.size() - 2) / sizeof(char16_t) };
+
+		entries.clear();
+		text.clear();
+
+		// a UTF-16 unit is at most 3 UTF-8 bytes, and each line adds at most two terminators.
+		// Reserving the worst case up front keeps the views into text valid while it is filled
+		text.reserve(content.size() * 5 + 2);
+
+		constexpr auto is_space = [](char16_t a_ch) {
+			return a_ch == u' ' || a_ch == u'\t' || a_ch == u'\r' || a_ch == u'\v' || a_ch == u'\f';
+		};
+		constexpr auto trim_front = [=](std::u16string_view a_str) {
+			while (!a_str.empty() && is_space(a_str.front())) {
+				a_str.remove_prefix(1);
+			}
+			return a_str;
+		};
+
+		std::size_t pos = 0;
+		while (pos < content.size()) {
+			auto end = content.find(u'\n', pos);
+			if (end == std::u16string_view::npos) {
+				end = content.size();
+			}
+
+			const auto line = trim_front(content.substr(pos, end - pos));
+			pos = end + 1;
+
+			if (line.empty()) {
+				continue;
+			}
+
+			// key, whitespace, value
+			const auto keyEnd = std::ranges::find_if(line, is_space) - line.begin();
+			const auto key = line.substr(0, keyEnd);
+			auto       value = trim_front(line.substr(keyEnd));
+
+			// remove space/new line at end
+			if (!value.empty() && is_space(value.back())) {
+				value.remove_suffix(1);
+			}
+
+			const auto utf8Key = AppendText(key);
+			entries.emplace_back(utf8Key, AppendText(value));
+		}
+
+		return true;
+	}
+
+	std::string_view File::AppendText(std::u16string_view a_str)
+	{
+		const auto begin = text.size();
+
+		for (std::size_t i = 0; i < a_str.size(); ++i) {
+			std::uint32_t ch = a_str[i];
+			if (ch >= 0xD800 && ch <= 0xDBFF && i + 1 < a_str.size() && a_str[i + 1] >= 0xDC00 && a_str[i + 1] <= 0xDFFF) {
+				ch = 0x10000 + ((ch - 0xD800) << 10) + (a_str[++i] - 0xDC00);
+			}
+
+			if (ch < 0x80) {
+				text.push_back(static_cast<char>(ch));
+			} else if (ch < 0x800) {
+				text.push_back(static_cast<char>(0xC0 | (ch >> 6)));
+				text.push_back(static_cast<char>(0x80 | (ch & 0x3F)));
+			} else if (ch < 0x10000) {
+				text.push_back(static_cast<char>(0xE0 | (ch >> 12)));
+				text.push_back(static_cast<char>(0x80 | ((ch >> 6) & 0x3F)));
+				text.push_back(static_cast<char>(0x80 | (ch & 0x3F)));
+			} else {
+				text.push_back(static_cast<char>(0xF0 | (ch >> 18)));
+				text.push_back(static_cast<char>(0x80 | ((ch >> 12) & 0x3F)));
+				text.push_back(static_cast<char>(0x80 | ((ch >> 6) & 0x3F)));
+				text.push_back(static_cast<char>(0x80 | (ch & 0x3F)));
+			}
+		}
+		text.push_back('\0');
+
+		return { text.data() + begin, text.size() - begin - 1 };
+	}
+
+	File::CacheResult File::LoadCache(const std::filesystem::path& a_path, std::uint64_t a_fileHash)
+	{
+		std::ifstream stream(a_path, std::ios::binary);
+		if (!stream.good()) {
+			return CacheResult::kMissing;
+		}
+
+		CacheHeader header{};
+		if (!stream.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic != CacheHeader::MAGIC || header.version != CacheHeader::VERSION || header.fileHash != a_fileHash) {
+			return CacheResult::kMissing;
+		}
+
+		// a truncated or corrupt cache must not size the allocations below
+		std::error_code ec;
+		const auto      fileSize = std::filesystem::file_size(a_path, ec);
+		if (ec || fileSize != sizeof(CacheHeader) + std::uint64_t(header.count) * sizeof(CacheEntry) + header.textSize) {
+			return CacheResult::kCorrupt;
+		}
+
+		std::vector<CacheEntry> cachedEntries(header.count);
+		std::vector<char>       cachedText(header.textSize);
+		if (!stream.read(reinterpret_cast<char*>(cachedEntries.data()), cachedEntries.size() * sizeof(CacheEntry)) || !stream.read(cachedText.data(), cachedText.size())) {
+			return CacheResult::kCorrupt;
+		}
+
+		const auto valid_range = [&](std::uint32_t a_offset, std::uint32_t a_size) {
+			return std::uint64_t(a_offset) + a_size < cachedText.size() && cachedText[a_offset + a_size] == '\0';
+		};
+		if (!std::ranges::all_of(cachedEntries, [&](const auto& a_entry) { return valid_range(a_entry.key, a_entry.keySize) && valid_range(a_entry.value, a_entry.valueSize); })) {
+			return CacheResult::kCorrupt;
+		}
+
+		text = std::move(cachedText);
+
+		entries.clear();
+		entries.reserve(cachedEntries.size());
+		for (const auto& entry : cachedEntries) {
+			entries.emplace_back(std::string_view(text.data() + entry.key, entry.keySize), std::string_view(text.data() + entry.value, entry.valueSize));
+		}
+
+		return CacheResult::kLoaded;
+	}
+
+	bool File::SaveCache(const std::filesystem::path& a_path, std::uint64_t a_fileHash) const
+	{
+		std::error_code ec;
+		std::filesystem::create_directories(a_path.parent_path(), ec);
+
+		std::ofstream stream(a_path, std::ios::binary | std::ios::trunc);
+		if (!stream.good()) {
+			return false;
+		}
+
+		const auto offset_of = [&](std::string_view a_str) {
+			return static_cast<std::uint32_t>(a_str.data() - text.data());
+		};
+
+		std::vector<CacheEntry> cachedEntries;
+		cachedEntries.reserve(entries.size());
+		for (const auto& [key, value] : entries) {
+			cachedEntries.push_back({ offset_of(key), static_cast<std::uint32_t>(key.size()), offset_of(value), static_cast<std::uint32_t>(value.size()) });
+		}
+
+		const CacheHeader header{ CacheHeader::MAGIC, CacheHeader::VERSION, a_fileHash, static_cast<std::uint32_t>(cachedEntries.size()), static_cast<std::uint32_t>(text.size()) };
+
+		stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		stream.write(reinterpret_cast<const char*>(cachedEntries.data()), cachedEntries.size() * sizeof(CacheEntry));
+		stream.write(text.data(), text.size());
+
+		return stream.good();
+	}
+}
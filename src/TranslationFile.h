@@ -0,0 +1,75 @@
+#pragma once
+
+namespace Translation
+{
+	// FNV-1a, usable at compile time for literal keys
+	constexpr std::uint64_t HashKey(std::string_view a_key)
+	{
+		std::uint64_t hash = 0xCBF29CE484222325;
+		for (const auto ch : a_key) {
+			hash ^= static_cast<std::uint8_t>(ch);
+			hash *= 0x100000001B3;
+		}
+		return hash;
+	}
+
+	// A translation file converted to UTF-8, and its binary cache. Only uses the standard library, so it is tested off Windows too.
+	// Files are UTF-16 LE with a BOM, one "key<whitespace>value" per line
+	class File
+	{
+	public:
+		enum class CacheResult
+		{
+			kLoaded,
+			kMissing,  // or made for another file or cache version
+			kCorrupt
+		};
+
+		File() = default;
+		File(const File&) = delete;
+		File(File&&) noexcept = default;
+		~File() = default;
+
+		File& operator=(const File&) = delete;
+		File& operator=(File&&) noexcept = default;
+
+		// false if the BOM isn't UTF-16 LE. a_bytes must be 2-byte aligned
+		bool Parse(std::span<const std::byte> a_bytes);
+
+		CacheResult LoadCache(const std::filesystem::path& a_path, std::uint64_t a_fileHash);
+		bool        SaveCache(const std::filesystem::path& a_path, std::uint64_t a_fileHash) const;
+
+		// in file order, duplicate keys included. Keys and values are null-terminated views into GetText
+		std::span<const std::pair<std::string_view, std::string_view>> GetEntries() const { return entries; }
+		std::span<const char>                                          GetText() const { return text; }
+
+	private:
+		// parsed translation files are cached as a header, (key, value) offsets into the UTF-8 text, then the text
+		struct CacheHeader
+		{
+			static constexpr std::uint32_t MAGIC = 0x52544D50;  // PMTR
+			static constexpr std::uint32_t VERSION = 1;
+
+			// members
+			std::uint32_t magic;
+			std::uint32_t version;
+			std::uint64_t fileHash;  // of the translation file
+			std::uint32_t count;
+			std::uint32_t textSize;
+		};
+		struct CacheEntry
+		{
+			// members
+			std::uint32_t key;
+			std::uint32_t keySize;
+			std::uint32_t value;
+			std::uint32_t valueSize;
+		};
+
+		std::string_view AppendText(std::u16string_view a_str);
+
+		// members
+		std::vector<char>                                         text{};  // UTF-8 keys and values, null-separated
+		std::vector<std::pair<std::string_view, std::string_view>> entries{};
+	};
+}
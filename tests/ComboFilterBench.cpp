@@ -0,0 +1,89 @@
+#include "ImGui/ComboFilter.h"
+#include "TestItems.h"
+
+namespace
+{
+	using clock = std::chrono::steady_clock;
+
+	struct FrameTimes
+	{
+		[[nodiscard]] double GetMean() const { return frames ? total / frames : 0.0; }
+
+		void Add(clock::duration a_duration)
+		{
+			const auto us = std::chrono::duration<double, std::micro>(a_duration).count();
+			total += us;
+			max = std::max(max, us);
+			++frames;
+		}
+
+		// members
+		double      total{ 0.0 };
+		double      max{ 0.0 };
+		std::size_t frames{ 0 };
+	};
+
+	// a combo open for a while: the pattern is typed one character per frame, then left alone
+	bool Benchmark(std::size_t a_itemCount, bool a_indexed)
+	{
+		static constexpr std::string_view typed{ "Steel Dag" };
+		static constexpr std::size_t      steadyFrames{ 2000 };
+
+		const auto                    items = Test::GenerateItems(a_itemCount);
+		std::vector<std::string_view> views(items.begin(), items.end());
+
+		ImGui::SearchIndex index;
+		if (a_indexed) {
+			index.Build(views);
+		}
+
+		ImGui::ComboFilter filter;
+		filter.SetSearchIndex(a_indexed ? &index : nullptr);
+
+		FrameTimes typing;   // frames where the pattern changed
+		FrameTimes waiting;  // frames showing the previous results while the worker scores
+		FrameTimes steady;   // frames after the results are in
+
+		const auto frame = [&](std::string_view a_pattern) {
+			const auto start = clock::now();
+			const auto count = filter.Update(a_pattern, views).size();
+			const auto duration = clock::now() - start;
+			return std::make_pair(duration, count);
+		};
+
+		for (std::size_t length = 1; length <= typed.size(); ++length) {
+			typing.Add(frame(typed.substr(0, length)).first);
+			while (filter.IsSearching()) {
+				std::this_thread::sleep_for(std::chrono::microseconds(100));
+				waiting.Add(frame(typed.substr(0, length)).first);
+			}
+		}
+
+		std::size_t matches = 0;
+		for (std::size_t i = 0; i < steadyFrames; ++i) {
+			const auto [duration, count] = frame(typed);
+			steady.Add(duration);
+			matches = count;
+		}
+
+		std::printf("%6zu items%s: %5zu matches | typing %9.1f us/frame (max %9.1f) | waiting %6.1f us/frame over %3zu frames | steady %6.3f us/frame (max %6.1f)\n",
+			a_itemCount, a_indexed ? ", indexed" : "        ", matches, typing.GetMean(), typing.max, waiting.GetMean(), waiting.frames, steady.GetMean(), steady.max);
+
+		// unchanged frames only compare the pattern, so they cost the same whatever the list size
+		const bool flat = steady.GetMean() * 20.0 < typing.GetMean();
+		if (!flat) {
+			std::fprintf(stderr, "FAILED: steady state frames should be much cheaper than rescoring\n");
+		}
+		return flat;
+	}
+}
+
+int main()
+{
+	bool passed = true;
+	for (const auto count : { 1000, 4000, 16000, 50000 }) {
+		passed &= Benchmark(count, false);
+		passed &= Benchmark(count, true);
+	}
+	return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
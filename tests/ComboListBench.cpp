@@ -0,0 +1,98 @@
+#include "HeadlessImGui.h"
+#include "ImGui/ComboWithFilter.h"
+#include "TestItems.h"
+
+namespace
+{
+	using clock = std::chrono::steady_clock;
+
+	struct Result
+	{
+		// members
+		std::size_t itemCount;
+		int         vertices;     // of the whole frame, the list only adds the visible rows
+		double      medianFrame;  // microseconds, NewFrame to Render
+	};
+
+	// an open combo over a_itemCount items, focused on the middle one, left alone for a while
+	Result Benchmark(std::size_t a_itemCount)
+	{
+		static constexpr std::size_t frames{ 500 };
+
+		const auto                    items = Test::GenerateItems(a_itemCount);
+		std::vector<std::string_view> views(items.begin(), items.end());
+
+		int    index = static_cast<int>(a_itemCount / 2);
+		ImVec2 comboCenter{};
+		bool   open = false;
+
+		Test::CreateHeadlessContext();
+
+		const auto frame = [&] {
+			const auto start = clock::now();
+
+			ImGui::NewFrame();
+			ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+			ImGui::SetNextWindowSize(ImVec2(800.0f, 600.0f));
+			ImGui::Begin("##Main", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoSavedSettings);
+			ImGui::ComboWithFilter("##forms", &index, views);
+			comboCenter = (ImGui::GetItemRectMin() + ImGui::GetItemRectMax()) * 0.5f;
+			open = ImGui::IsPopupOpen(Test::GetComboPopupID("##forms"), ImGuiPopupFlags_None);
+			ImGui::End();
+			ImGui::Render();
+			FrameArena::GetSingleton()->Reset();
+
+			return clock::now() - start;
+		};
+
+		frame();
+		Test::Click(comboCenter, frame);
+		for (int i = 0; i < 10; ++i) {
+			frame();
+		}
+
+		std::vector<double> durations;
+		durations.reserve(frames);
+		for (std::size_t i = 0; i < frames; ++i) {
+			durations.push_back(std::chrono::duration<double, std::micro>(frame()).count());
+		}
+		std::ranges::nth_element(durations, durations.begin() + durations.size() / 2);
+
+		const Result result{ a_itemCount, open ? ImGui::GetDrawData()->TotalVtxCount : -1, durations[durations.size() / 2] };
+
+		ImGui::DestroyContext();
+
+		return result;
+	}
+}
+
+int main()
+{
+	static constexpr std::array<std::size_t, 4> itemCounts{ 100, 1000, 10000, 50000 };
+
+	std::vector<Result> results;
+	for (const auto count : itemCounts) {
+		const auto& result = results.emplace_back(Benchmark(count));
+		std::printf("%6zu items: %6d vertices, %8.1f us median frame\n", result.itemCount, result.vertices, result.medianFrame);
+	}
+
+	bool passed = true;
+
+	const auto& smallest = results.front();
+	const auto& largest = results.back();
+	if (smallest.vertices < 0 || largest.vertices < 0) {
+		std::fprintf(stderr, "FAILED: the combo did not open\n");
+		passed = false;
+	}
+	// the popup shows the same rows whatever the list size. Without clipping every row is submitted,
+	// which is a few hundred times slower at 50000 items
+	else if (largest.vertices > smallest.vertices + smallest.vertices / 10) {
+		std::fprintf(stderr, "FAILED: %zu items drew %d vertices, %zu items %d\n", largest.itemCount, largest.vertices, smallest.itemCount, smallest.vertices);
+		passed = false;
+	} else if (largest.medianFrame > smallest.medianFrame * 10.0) {
+		std::fprintf(stderr, "FAILED: %zu items took %.1f us per frame, %zu items %.1f us\n", largest.itemCount, largest.medianFrame, smallest.itemCount, smallest.medianFrame);
+		passed = false;
+	}
+
+	return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,172 @@
+#include "ImGui/GlyphSet.h"
+
+namespace
+{
+	using clock = std::chrono::steady_clock;
+
+	// runtime names in the scripts the shipped translations use beyond Latin-1: Latin Extended-A (Czech, Polish), Greek and Cyrillic (Russian)
+	std::vector<std::string> GenerateNames(std::size_t a_count)
+	{
+		static constexpr std::array<std::pair<char32_t, char32_t>, 4> scripts{ {
+			{ U'a', U'z' },
+			{ 0x0100, 0x017F },
+			{ 0x0391, 0x03C9 },
+			{ 0x0410, 0x044F },
+		} };
+
+		const auto append_utf8 = [](std::string& a_str, char32_t a_ch) {
+			if (a_ch < 0x80) {
+				a_str.push_back(static_cast<char>(a_ch));
+			} else {
+				a_str.push_back(static_cast<char>(0xC0 | (a_ch >> 6)));
+				a_str.push_back(static_cast<char>(0x80 | (a_ch & 0x3F)));
+			}
+		};
+
+		std::mt19937                               rng{ 42 };
+		std::uniform_int_distribution<std::size_t> script{ 0, scripts.size() - 1 };
+		std::uniform_int_distribution<std::size_t> length{ 4, 8 };
+
+		std::vector<std::string> names;
+		names.reserve(a_count);
+		for (std::size_t i = 0; i < a_count; ++i) {
+			const auto [first, last] = scripts[script(rng)];
+			std::uniform_int_distribution<std::uint32_t> letter{ first, last };
+
+			auto& name = names.emplace_back();
+			for (std::size_t j = 0, count = length(rng); j < count; ++j) {
+				append_utf8(name, letter(rng));
+			}
+		}
+		return names;
+	}
+
+	// how the fonts were rebuilt before: every missing glyph on its own
+	class PerGlyph
+	{
+	public:
+		explicit PerGlyph(const ImFontGlyphRangesBuilder& a_static) :
+			glyphs(a_static)
+		{}
+
+		bool Add(std::string_view a_text)
+		{
+			bool added = false;
+
+			auto       text = a_text.data();
+			const auto textEnd = text + a_text.size();
+			while (text < textEnd) {
+				unsigned int c = 0;
+				const auto   length = ImTextCharFromUtf8(&c, text, textEnd);
+				if (length == 0) {
+					break;
+				}
+				text += length;
+
+				if (c != 0 && c <= IM_UNICODE_CODEPOINT_MAX && !glyphs.GetBit(c)) {
+					glyphs.SetBit(c);
+					added = true;
+				}
+			}
+
+			return added;
+		}
+
+		void BuildRanges(ImVector<ImWchar>& a_ranges)
+		{
+			a_ranges.clear();
+			glyphs.BuildRanges(&a_ranges);
+		}
+
+	private:
+		// members
+		ImFontGlyphRangesBuilder glyphs;
+	};
+
+	struct Result
+	{
+		// members
+		std::size_t rebuilds{ 0 };
+		double      buildTime{ 0.0 };  // milliseconds, rebuilds only
+		int         glyphs{ 0 };       // of the regular font after the last rebuild
+	};
+
+	// both font sizes, like IconFont::Manager::LoadFonts
+	void Build(ImFontAtlas& a_atlas, const ImVector<ImWchar>& a_ranges)
+	{
+		static const auto font = (std::filesystem::path(FONTS_FOLDER) / "Jost-Regular.ttf").string();
+
+		a_atlas.Clear();
+		a_atlas.AddFontFromFileTTF(font.c_str(), 26.0f, nullptr, a_ranges.Data);
+		a_atlas.AddFontFromFileTTF(font.c_str(), 30.0f, nullptr, a_ranges.Data);
+		a_atlas.Build();
+	}
+
+	// one name shown per frame, the fonts are rebuilt before the next frame if it needs new glyphs
+	Result Benchmark(auto& a_glyphs, std::span<const std::string> a_names)
+	{
+		ImFontAtlas       atlas;
+		ImVector<ImWchar> ranges;
+
+		a_glyphs.BuildRanges(ranges);
+		Build(atlas, ranges);
+
+		Result result;
+		for (const auto& name : a_names) {
+			if (a_glyphs.Add(name)) {
+				const auto start = clock::now();
+				a_glyphs.BuildRanges(ranges);
+				Build(atlas, ranges);
+				result.buildTime += std::chrono::duration<double, std::milli>(clock::now() - start).count();
+				++result.rebuilds;
+			}
+		}
+		result.glyphs = atlas.Fonts.empty() ? 0 : atlas.Fonts[0]->Glyphs.Size;
+
+		return result;
+	}
+}
+
+int main()
+{
+	ImGui::CreateContext();
+
+	// Basic Latin + Latin-1 Supplement, as in IconFont::Manager::BuildGlyphRanges
+	static constexpr std::array<ImWchar, 3> latinRange{ 0x0020, 0x00FF, 0 };
+	ImFontGlyphRangesBuilder                staticGlyphs;
+	staticGlyphs.AddRanges(latinRange.data());
+
+	const auto names = GenerateNames(300);
+
+	PerGlyph   perGlyph(staticGlyphs);
+	const auto before = Benchmark(perGlyph, names);
+
+	IconFont::GlyphSet glyphSet;
+	glyphSet.SetStatic(staticGlyphs);
+	const bool staticBefore = glyphSet.IsStatic();
+	const auto after = Benchmark(glyphSet, names);
+
+	std::printf("%zu runtime names\n", names.size());
+	std::printf("per glyph: %3zu rebuilds, %8.1f ms, %4d glyphs\n", before.rebuilds, before.buildTime, before.glyphs);
+	std::printf("per page:  %3zu rebuilds, %8.1f ms, %4d glyphs\n", after.rebuilds, after.buildTime, after.glyphs);
+
+	bool passed = true;
+
+	// one rebuild per script: Latin Extended-A, Greek and Cyrillic are one page each
+	if (after.rebuilds > 3 || after.rebuilds >= before.rebuilds) {
+		std::fprintf(stderr, "FAILED: %zu rebuilds per page, %zu per glyph\n", after.rebuilds, before.rebuilds);
+		passed = false;
+	}
+	if (after.glyphs < before.glyphs) {
+		std::fprintf(stderr, "FAILED: the pages baked fewer glyphs (%d) than the names needed (%d)\n", after.glyphs, before.glyphs);
+		passed = false;
+	}
+	if (!staticBefore || glyphSet.IsStatic()) {
+		std::fprintf(stderr, "FAILED: only the static glyphs should use the atlas cache\n");
+		passed = false;
+	}
+
+	ImGui::DestroyContext();
+
+	return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,184 @@
+#include "HeadlessImGui.h"
+#include "ImGui/ComboWithFilter.h"
+#include "TestItems.h"
+
+// every global operator new while counting is on, from any thread
+namespace
+{
+	std::atomic<bool>        counting{ false };
+	std::atomic<std::size_t> heapAllocations{ 0 };
+}
+
+void* operator new(std::size_t a_bytes)
+{
+	if (counting.load(std::memory_order_relaxed)) {
+		heapAllocations.fetch_add(1, std::memory_order_relaxed);
+	}
+	if (void* ptr = std::malloc(a_bytes ? a_bytes : 1)) {
+		return ptr;
+	}
+	throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t a_bytes)
+{
+	return ::operator new(a_bytes);
+}
+
+void operator delete(void* a_ptr) noexcept
+{
+	std::free(a_ptr);
+}
+
+void operator delete[](void* a_ptr) noexcept
+{
+	std::free(a_ptr);
+}
+
+void operator delete(void* a_ptr, std::size_t) noexcept
+{
+	std::free(a_ptr);
+}
+
+void operator delete[](void* a_ptr, std::size_t) noexcept
+{
+	std::free(a_ptr);
+}
+
+namespace
+{
+	// a Photo Mode tab: labelled widgets, a combo with its own filter over a form list, and one relying on the default filters
+	class Tab
+	{
+	public:
+		explicit Tab(std::span<const std::string_view> a_items) :
+			items(a_items)
+		{}
+
+		void SetShowUnfiltered(bool a_show) { showUnfiltered = a_show; }
+
+		[[nodiscard]] ImVec2              GetComboCenter() const { return comboCenter; }
+		[[nodiscard]] bool                IsComboOpen() const { return comboOpen; }
+		[[nodiscard]] ImGui::ComboFilter& GetFilter() { return filter; }
+
+		void Draw()
+		{
+			ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+			ImGui::SetNextWindowSize(ImVec2(800.0f, 600.0f));
+			ImGui::Begin("##Main", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoSavedSettings);
+			{
+				// longer than the small string buffer, so the label is built in the frame arena
+				auto newLabel = ImGui::LeftAlignedText("Field of view (degrees)");
+				ImGui::SliderFloat(newLabel.c_str(), &fov, 20.0f, 120.0f);
+
+				newLabel = ImGui::LeftAlignedText("Camera roll (degrees)");
+				ImGui::SliderFloat(newLabel.c_str(), &roll, -180.0f, 180.0f);
+
+				ImGui::ComboWithFilter("##forms", &index, items, &filter);
+				comboCenter = (ImGui::GetItemRectMin() + ImGui::GetItemRectMax()) * 0.5f;
+				comboOpen = ImGui::IsPopupOpen(Test::GetComboPopupID("##forms"), ImGuiPopupFlags_None);
+
+				if (showUnfiltered) {
+					ImGui::ComboWithFilter("##unfiltered", &unfilteredIndex, items);
+				}
+			}
+			ImGui::End();
+		}
+
+	private:
+		// members
+		std::span<const std::string_view> items;
+		ImGui::ComboFilter                filter{};
+		int                               index{ 0 };
+		int                               unfilteredIndex{ 0 };
+		float                             fov{ 70.0f };
+		float                             roll{ 0.0f };
+		bool                              showUnfiltered{ false };
+		ImVec2                            comboCenter{};
+		bool                              comboOpen{ false };
+	};
+
+	// a whole frame, like the render hook: new frame, draw, render, then release the frame arena
+	std::size_t Frame(Tab& a_tab)
+	{
+		const auto before = heapAllocations.load();
+
+		counting = true;
+		ImGui::NewFrame();
+		a_tab.Draw();
+		ImGui::Render();
+		FrameArena::GetSingleton()->Reset();
+		counting = false;
+
+		return heapAllocations.load() - before;
+	}
+
+	std::size_t Frames(Tab& a_tab, std::size_t a_count)
+	{
+		std::size_t allocations = 0;
+		for (std::size_t i = 0; i < a_count; ++i) {
+			allocations += Frame(a_tab);
+		}
+		return allocations;
+	}
+
+	bool Check(bool a_condition, const char* a_message, std::size_t a_allocations)
+	{
+		if (!a_condition) {
+			std::fprintf(stderr, "FAILED: %s (%zu heap allocations)\n", a_message, a_allocations);
+		}
+		return a_condition;
+	}
+}
+
+int main()
+{
+	// below the async threshold, so that every allocation is made on this thread
+	const auto                    items = Test::GenerateItems(1000);
+	std::vector<std::string_view> views(items.begin(), items.end());
+
+	Test::CreateHeadlessContext();
+
+	Tab  tab(views);
+	bool passed = true;
+
+	// let the arena and ImGui settle
+	Frames(tab, 10);
+
+	auto allocations = Frames(tab, 100);
+	passed &= Check(allocations == 0, "frames with the combo closed should not allocate", allocations);
+
+	// a combo without a filter only gets one once it filters
+	tab.SetShowUnfiltered(true);
+	allocations = Frames(tab, 100);
+	passed &= Check(allocations == 0, "closed combos without a filter should not allocate", allocations);
+
+	// click the combo open
+	Test::Click(tab.GetComboCenter(), [&] { Frame(tab); });
+	Frames(tab, 5);
+	passed &= Check(tab.IsComboOpen(), "the combo should open on click", 0);
+
+	// the filter input has focus, type into it
+	ImGui::GetIO().AddInputCharactersUTF8("iron");
+	auto typingAllocations = Frames(tab, 5);
+	passed &= Check(typingAllocations > 0, "typing should score the items", typingAllocations);
+
+	allocations = Frames(tab, 100);
+	passed &= Check(allocations == 0, "frames with the combo open and the results in should not allocate", allocations);
+
+	// the results the combo shows are the filter's cached ones
+	counting = true;
+	const auto before = heapAllocations.load();
+	const auto shown = tab.GetFilter().Update("iron", views).size();
+	allocations = heapAllocations.load() - before;
+	counting = false;
+	passed &= Check(allocations == 0 && shown > 0, "the combo should have filtered by the typed pattern", allocations);
+
+	ImGui::DestroyContext();
+
+	if (passed) {
+		std::printf("FrameAllocation: %zu results for \"iron\", %zu allocations while typing, none in steady frames\n", shown, typingAllocations);
+	}
+
+	return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,90 @@
+#include "FrameArena.h"
+
+namespace
+{
+	// forwards to the heap and counts every allocation the arena makes
+	class CountingResource final : public std::pmr::memory_resource
+	{
+	public:
+		[[nodiscard]] std::size_t GetAllocations() const { return allocations; }
+
+	private:
+		void* do_allocate(std::size_t a_bytes, std::size_t a_alignment) override
+		{
+			++allocations;
+			return std::pmr::new_delete_resource()->allocate(a_bytes, a_alignment);
+		}
+		void do_deallocate(void* a_ptr, std::size_t a_bytes, std::size_t a_alignment) override
+		{
+			std::pmr::new_delete_resource()->deallocate(a_ptr, a_bytes, a_alignment);
+		}
+		bool do_is_equal(const std::pmr::memory_resource& a_other) const noexcept override { return this == &a_other; }
+
+		// members
+		std::size_t allocations{ 0 };
+	};
+
+	// the kind of temporaries a Photo Mode frame makes: labels, icon lists and a character group
+	void SimulateFrame(FrameArena& a_arena, std::size_t a_labelCount)
+	{
+		const std::pmr::polymorphic_allocator<> allocator(&a_arena);
+
+		FrameVector<FrameString> labels(allocator);
+		for (std::size_t i = 0; i < a_labelCount; ++i) {
+			auto& label = labels.emplace_back("##label that is too long for the small string buffer ");
+			label += std::to_string(i);
+		}
+
+		FrameVector<const void*> icons(allocator);
+		icons.reserve(8);
+		for (const auto& label : labels) {
+			icons.push_back(label.data());
+		}
+
+		FrameSet<std::size_t> group(allocator);
+		for (std::size_t i = 0; i < 32; ++i) {
+			group.insert(i);
+		}
+	}
+
+	bool Check(bool a_condition, const char* a_message)
+	{
+		if (!a_condition) {
+			std::fprintf(stderr, "FAILED: %s\n", a_message);
+		}
+		return a_condition;
+	}
+}
+
+int main()
+{
+	CountingResource upstream;
+	bool             passed = true;
+
+	{
+		FrameArena arena(&upstream);
+
+		// the first frame overflows the initial buffer, which grows on reset
+		SimulateFrame(arena, 4096);
+		arena.Reset();
+		passed &= Check(upstream.GetAllocations() > 2, "first frame should overflow into upstream allocations");
+
+		const auto warmedUp = upstream.GetAllocations();
+		for (int frame = 0; frame < 100; ++frame) {
+			SimulateFrame(arena, 4096);
+			arena.Reset();
+		}
+		passed &= Check(upstream.GetAllocations() == warmedUp, "steady state frames should not allocate from upstream");
+
+		// smaller frames fit in the grown buffer too
+		SimulateFrame(arena, 16);
+		arena.Reset();
+		passed &= Check(upstream.GetAllocations() == warmedUp, "smaller frames should not allocate from upstream");
+	}
+
+	if (passed) {
+		std::printf("FrameArena: %zu upstream allocations, none after the first frame\n", upstream.GetAllocations());
+	}
+
+	return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
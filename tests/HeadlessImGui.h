@@ -0,0 +1,39 @@
+#pragma once
+
+namespace Test
+{
+	// an ImGui context without a backend: fixed display size and time step, the default font, nothing saved to disk
+	inline void CreateHeadlessContext()
+	{
+		ImGui::CreateContext();
+
+		auto& io = ImGui::GetIO();
+		io.IniFilename = nullptr;
+		io.LogFilename = nullptr;
+		io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+		io.DeltaTime = 1.0f / 60.0f;
+
+		unsigned char* pixels = nullptr;
+		int            width = 0;
+		int            height = 0;
+		io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+	}
+
+	// moves the mouse over a_pos, then presses and releases the left button, one event per frame
+	inline void Click(ImVec2 a_pos, std::invocable auto&& a_frame)
+	{
+		auto& io = ImGui::GetIO();
+		io.AddMousePosEvent(a_pos.x, a_pos.y);
+		a_frame();
+		io.AddMouseButtonEvent(ImGuiMouseButton_Left, true);
+		a_frame();
+		io.AddMouseButtonEvent(ImGuiMouseButton_Left, false);
+		a_frame();
+	}
+
+	// ID of the popup of a combo in the current window, as BeginCombo makes it
+	inline ImGuiID GetComboPopupID(const char* a_label)
+	{
+		return ImHashStr("##ComboPopup", 0, ImGui::GetID(a_label));
+	}
+}
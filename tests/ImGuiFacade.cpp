@@ -0,0 +1,15 @@
+#include "ImGui/Renderer.h"
+
+namespace RE
+{
+	void PlaySound(const char*)
+	{}
+}
+
+namespace ImGui::Renderer
+{
+	float GetResolutionScale()
+	{
+		return 1.0f;
+	}
+}
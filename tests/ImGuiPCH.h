@@ -0,0 +1,25 @@
+#pragma once
+
+#include "PCH.h"
+
+#include <ankerl/unordered_dense.h>
+
+#define IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui_internal.h"
+#include <imgui.h>
+
+// the few engine and Windows names the ImGui helpers use, defined in ImGuiFacade.cpp
+
+#ifndef MAX_PATH
+#	define MAX_PATH 260
+#endif
+
+template <class K, class D>
+using Map = ankerl::unordered_dense::segmented_map<K, D>;
+
+class CSimpleIniA;
+
+namespace RE
+{
+	void PlaySound(const char* a_editorID);
+}
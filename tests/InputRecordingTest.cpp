@@ -0,0 +1,127 @@
+#include "InputRecording.h"
+
+namespace
+{
+	using LoadResult = InputRecorder::Recording::LoadResult;
+
+	bool Check(bool a_condition, const char* a_message)
+	{
+		if (!a_condition) {
+			std::fprintf(stderr, "FAILED: %s\n", a_message);
+		}
+		return a_condition;
+	}
+
+	Input::Event MakeEvent(Input::Event::KIND a_kind, std::uint32_t a_key, float a_value = 0.0f, float a_heldDuration = 0.0f)
+	{
+		Input::Event event{};
+		event.kind = a_kind;
+		event.key = a_key;
+		event.value = a_value;
+		event.heldDuration = a_heldDuration;
+		return event;
+	}
+
+	bool SameEvents(std::span<const Input::Event> a_lhs, std::span<const Input::Event> a_rhs)
+	{
+		return a_lhs.size() == a_rhs.size() && std::memcmp(a_lhs.data(), a_rhs.data(), a_lhs.size_bytes()) == 0;
+	}
+
+	// overwrites a_size bytes at a_offset
+	void Patch(const std::filesystem::path& a_path, std::size_t a_offset, const void* a_bytes, std::size_t a_size)
+	{
+		std::fstream stream(a_path, std::ios::binary | std::ios::in | std::ios::out);
+		stream.seekp(static_cast<std::streamoff>(a_offset));
+		stream.write(static_cast<const char*>(a_bytes), static_cast<std::streamsize>(a_size));
+	}
+}
+
+int main()
+{
+	const auto folder = std::filesystem::temp_directory_path() / "PhotoModeInputRecordingTest";
+	const auto path = folder / "session.bin";
+
+	bool passed = true;
+
+	// a key held over frames 0-2 with a character on frame 1, nothing on frame 3, escape on frame 4
+	InputRecorder::Recording recording;
+	{
+		auto down = MakeEvent(Input::Event::KIND::kButton, 0xC8, 1.0f);
+		auto held = MakeEvent(Input::Event::KIND::kButton, 0xC8, 1.0f, 0.016f);
+		auto ch = MakeEvent(Input::Event::KIND::kChar, 'i');
+		auto up = MakeEvent(Input::Event::KIND::kButton, 0xC8, 0.0f, 0.033f);
+		auto escape = MakeEvent(Input::Event::KIND::kButton, 0x01, 1.0f);
+
+		recording.Add(down);
+		recording.NextFrame();
+		recording.Add(held);
+		recording.Add(ch);
+		recording.NextFrame();
+		recording.Add(up);
+		recording.NextFrame();
+		recording.NextFrame();
+		recording.Add(escape);
+		recording.NextFrame();
+
+		passed &= Check(down.frame == 0 && held.frame == 1 && ch.frame == 1 && up.frame == 2 && escape.frame == 4, "events should be stamped with the frame they arrived on");
+	}
+	passed &= Check(recording.GetEvents().size() == 5 && recording.GetFrameCount() == 5, "the recording should count the events and frames");
+
+	// round trip
+	passed &= Check(recording.Save(path), "the recording should be written");
+
+	InputRecorder::Recording loaded;
+	passed &= Check(loaded.Load(path) == LoadResult::kLoaded, "the recording should load");
+	passed &= Check(SameEvents(loaded.GetEvents(), recording.GetEvents()) && loaded.GetFrameCount() == recording.GetFrameCount(), "the loaded recording should match the saved one");
+
+	// replay, frame by frame
+	{
+		std::vector<std::size_t> perFrame;
+		std::uint32_t            frame = 0;
+		for (; !loaded.IsFinished(frame); ++frame) {
+			const auto events = loaded.GetFrameEvents(frame);
+			passed &= Check(std::ranges::all_of(events, [&](const auto& a_event) { return a_event.frame == frame; }), "a frame should only replay its own events");
+			perFrame.push_back(events.size());
+		}
+		passed &= Check(perFrame == std::vector<std::size_t>{ 1, 2, 1, 0, 1 } && frame == 5, "every event should be replayed once, on its frame");
+
+		loaded.Rewind();
+		passed &= Check(loaded.GetFrameEvents(1).size() == 3, "after a rewind, a late first frame should catch up on the earlier events");
+	}
+
+	// rejected files
+	{
+		InputRecorder::Recording rejected;
+		passed &= Check(rejected.Load(folder / "missing.bin") == LoadResult::kMissing, "a missing recording should not load");
+
+		const auto copy = folder / "copy.bin";
+
+		std::filesystem::copy_file(path, copy, std::filesystem::copy_options::overwrite_existing);
+		constexpr std::uint32_t version{ 1 };
+		Patch(copy, sizeof(std::uint32_t), &version, sizeof(version));
+		passed &= Check(rejected.Load(copy) == LoadResult::kVersion, "a recording of another version should not load");
+
+		std::filesystem::copy_file(path, copy, std::filesystem::copy_options::overwrite_existing);
+		constexpr std::uint32_t eventSize{ sizeof(Input::Event) + 4 };
+		Patch(copy, sizeof(std::uint32_t) * 2, &eventSize, sizeof(eventSize));
+		passed &= Check(rejected.Load(copy) == LoadResult::kVersion, "a recording with another event layout should not load");
+
+		std::filesystem::copy_file(path, copy, std::filesystem::copy_options::overwrite_existing);
+		constexpr std::uint32_t magic{ 0 };
+		Patch(copy, 0, &magic, sizeof(magic));
+		passed &= Check(rejected.Load(copy) == LoadResult::kInvalid, "a file that isn't a recording should not load");
+
+		std::filesystem::copy_file(path, copy, std::filesystem::copy_options::overwrite_existing);
+		std::filesystem::resize_file(copy, std::filesystem::file_size(copy) - 1);
+		passed &= Check(rejected.Load(copy) == LoadResult::kTruncated && rejected.GetEvents().empty(), "a truncated recording should not load");
+	}
+
+	std::error_code ec;
+	std::filesystem::remove_all(folder, ec);
+
+	if (passed) {
+		std::printf("InputRecording: %zu events over %u frames, %zu bytes per event\n", recording.GetEvents().size(), recording.GetFrameCount(), sizeof(Input::Event));
+	}
+
+	return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
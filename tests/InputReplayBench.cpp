@@ -0,0 +1,278 @@
+#include "HeadlessImGui.h"
+#include "ImGui/ComboWithFilter.h"
+#include "InputRecording.h"
+#include "TestItems.h"
+
+// Replays a recorded Photo Mode session through the real widgets, twice, and times each part of it.
+// The engine half of Input::Manager::ProcessInput (hotkeys, tabs, the camera) needs the game and isn't replayed,
+// the ImGui half is stubbed below for the keys the session uses
+namespace
+{
+	using clock = std::chrono::steady_clock;
+
+	// DirectInput scan codes, as RE::BSWin32KeyboardDevice::Key
+	enum class KEY : std::uint32_t
+	{
+		kEscape = 0x01,
+		kEnter = 0x1C,
+		kSpacebar = 0x39,
+		kUp = 0xC8,
+		kLeft = 0xCB,
+		kRight = 0xCD,
+		kDown = 0xD0,
+	};
+
+	ImGuiKey ToImGuiKey(KEY a_key)
+	{
+		switch (a_key) {
+		case KEY::kEscape:
+			return ImGuiKey_Escape;
+		case KEY::kEnter:
+			return ImGuiKey_Enter;
+		case KEY::kSpacebar:
+			return ImGuiKey_Space;
+		case KEY::kUp:
+			return ImGuiKey_UpArrow;
+		case KEY::kLeft:
+			return ImGuiKey_LeftArrow;
+		case KEY::kRight:
+			return ImGuiKey_RightArrow;
+		case KEY::kDown:
+			return ImGuiKey_DownArrow;
+		default:
+			return ImGuiKey_None;
+		}
+	}
+
+	// what Input::Manager::ProcessInput sends to ImGui for keyboard input
+	void ProcessInput(const Input::Event& a_event)
+	{
+		if (a_event.kind == Input::Event::KIND::kChar) {
+			ImGui::GetIO().AddInputCharacter(a_event.key);
+		} else if (a_event.device == RE::INPUT_DEVICE::kKeyboard) {
+			ImGui::GetIO().AddKeyEvent(ToImGuiKey(static_cast<KEY>(a_event.key)), a_event.IsPressed());
+		}
+	}
+
+	// what the input sink would record: a press and release per key, characters on their own
+	class Session
+	{
+	public:
+		struct Part
+		{
+			// members
+			const char*   name;
+			std::uint32_t firstFrame;
+		};
+
+		void BeginPart(const char* a_name) { parts.push_back({ a_name, recording.GetFrameCount() }); }
+
+		void Press(KEY a_key, std::uint32_t a_heldFrames = 1)
+		{
+			Input::Event event{};
+			event.key = std::to_underlying(a_key);
+			event.value = 1.0f;
+			recording.Add(event);
+			recording.NextFrame();
+
+			for (std::uint32_t i = 1; i < a_heldFrames; ++i) {
+				event.heldDuration = i / 60.0f;
+				recording.Add(event);
+				recording.NextFrame();
+			}
+
+			event.value = 0.0f;
+			event.heldDuration = a_heldFrames / 60.0f;
+			recording.Add(event);
+			recording.NextFrame();
+		}
+
+		void Type(std::string_view a_text)
+		{
+			for (const auto ch : a_text) {
+				Input::Event event{};
+				event.kind = Input::Event::KIND::kChar;
+				event.key = static_cast<std::uint32_t>(ch);
+				recording.Add(event);
+				recording.NextFrame();
+			}
+		}
+
+		void Wait(std::uint32_t a_frames)
+		{
+			for (std::uint32_t i = 0; i < a_frames; ++i) {
+				recording.NextFrame();
+			}
+		}
+
+		[[nodiscard]] const InputRecorder::Recording& GetRecording() const { return recording; }
+		[[nodiscard]] std::span<const Part>           GetParts() const { return parts; }
+
+	private:
+		// members
+		InputRecorder::Recording recording{};
+		std::vector<Part>        parts{};
+	};
+
+	// a Photo Mode tab: a form combo and two sliders, navigated with the keyboard
+	class Tab
+	{
+	public:
+		explicit Tab(std::span<const std::string_view> a_items) :
+			items(a_items)
+		{}
+
+		void Draw()
+		{
+			ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+			ImGui::SetNextWindowSize(ImVec2(800.0f, 600.0f));
+			ImGui::Begin("##Main", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoSavedSettings);
+			{
+				ImGui::ComboWithFilter("##forms", &index, items, &filter);
+
+				auto newLabel = ImGui::LeftAlignedText("Field of view (degrees)");
+				ImGui::SliderFloat(newLabel.c_str(), &fov, 20.0f, 120.0f);
+
+				newLabel = ImGui::LeftAlignedText("Camera roll (degrees)");
+				ImGui::SliderFloat(newLabel.c_str(), &roll, -180.0f, 180.0f);
+			}
+			ImGui::End();
+		}
+
+		bool operator==(const Tab& a_rhs) const { return index == a_rhs.index && fov == a_rhs.fov && roll == a_rhs.roll; }
+
+		// members
+		std::span<const std::string_view> items;
+		ImGui::ComboFilter                filter{};
+		int                               index{ 0 };
+		float                             fov{ 70.0f };
+		float                             roll{ 0.0f };
+	};
+
+	struct Replay
+	{
+		// members
+		std::vector<int>    vertices;    // per frame
+		std::vector<double> frameTimes;  // microseconds, NewFrame to Render
+		Tab                 tab;
+	};
+
+	// like InputRecorder::Manager: a frame's events are sent before ImGui starts it
+	Replay Run(InputRecorder::Recording& a_recording, std::span<const std::string_view> a_items)
+	{
+		Test::CreateHeadlessContext();
+		ImGui::GetIO().ConfigFlags = ImGuiConfigFlags_NavEnableKeyboard | ImGuiConfigFlags_NavEnableGamepad;
+
+		Replay replay{ {}, {}, Tab(a_items) };
+
+		a_recording.Rewind();
+		for (std::uint32_t frame = 0; !a_recording.IsFinished(frame); ++frame) {
+			for (const auto& event : a_recording.GetFrameEvents(frame)) {
+				ProcessInput(event);
+			}
+
+			const auto start = clock::now();
+			ImGui::NewFrame();
+			replay.tab.Draw();
+			ImGui::Render();
+			replay.frameTimes.push_back(std::chrono::duration<double, std::micro>(clock::now() - start).count());
+
+			replay.vertices.push_back(ImGui::GetDrawData()->TotalVtxCount);
+			FrameArena::GetSingleton()->Reset();
+		}
+
+		ImGui::DestroyContext();
+
+		return replay;
+	}
+
+	double Median(std::vector<double> a_values)
+	{
+		if (a_values.empty()) {
+			return 0.0;
+		}
+		std::ranges::nth_element(a_values, a_values.begin() + a_values.size() / 2);
+		return a_values[a_values.size() / 2];
+	}
+
+	bool Check(bool a_condition, const char* a_message)
+	{
+		if (!a_condition) {
+			std::fprintf(stderr, "FAILED: %s\n", a_message);
+		}
+		return a_condition;
+	}
+}
+
+int main()
+{
+	// below the async threshold, so that the results land on the same frame in every replay
+	const auto                    items = Test::GenerateItems(2000);
+	std::vector<std::string_view> views(items.begin(), items.end());
+
+	Session session;
+	session.BeginPart("settle");
+	session.Wait(10);
+
+	session.BeginPart("combo filtering");
+	session.Press(KEY::kDown);  // focus the combo
+	session.Press(KEY::kSpacebar);
+	session.Type("iron");
+	session.Wait(5);
+	session.Press(KEY::kDown);
+	session.Press(KEY::kDown);
+	session.Press(KEY::kEnter);
+
+	session.BeginPart("navigation");
+	session.Press(KEY::kDown);
+	session.Press(KEY::kUp);
+	session.Press(KEY::kDown);
+
+	session.BeginPart("slider drags");
+	session.Press(KEY::kSpacebar);
+	session.Press(KEY::kRight, 30);
+	session.Press(KEY::kSpacebar);
+	session.Press(KEY::kDown);
+	session.Press(KEY::kSpacebar);
+	session.Press(KEY::kLeft, 30);
+	session.Press(KEY::kSpacebar);
+
+	session.BeginPart("idle");
+	session.Wait(60);
+
+	// the file a recorded session is replayed from
+	const auto path = std::filesystem::temp_directory_path() / "PhotoModeInputReplayBench.bin";
+
+	InputRecorder::Recording recording;
+	bool                     passed = true;
+	passed &= Check(session.GetRecording().Save(path), "the session should be written");
+	passed &= Check(recording.Load(path) == InputRecorder::Recording::LoadResult::kLoaded, "the session should load");
+	passed &= Check(recording.GetFrameCount() == session.GetRecording().GetFrameCount() && recording.GetEvents().size() == session.GetRecording().GetEvents().size(), "the loaded session should match the recorded one");
+
+	std::error_code ec;
+	std::filesystem::remove(path, ec);
+
+	const auto first = Run(recording, views);
+	const auto second = Run(recording, views);
+
+	const auto parts = session.GetParts();
+	for (std::size_t i = 0; i < parts.size(); ++i) {
+		const auto begin = std::min<std::size_t>(parts[i].firstFrame, first.frameTimes.size());
+		const auto end = i + 1 < parts.size() ? std::min<std::size_t>(parts[i + 1].firstFrame, first.frameTimes.size()) : first.frameTimes.size();
+
+		// the faster of the two replays of each frame
+		std::vector<double> times(first.frameTimes.begin() + begin, first.frameTimes.begin() + end);
+		for (std::size_t j = begin; j < end; ++j) {
+			times[j - begin] = std::min(times[j - begin], second.frameTimes[j]);
+		}
+		std::printf("%-16s %4zu frames, median %8.1f us\n", parts[i].name, end - begin, Median(std::move(times)));
+	}
+	std::printf("combo index %d, fov %.1f, roll %.1f\n", first.tab.index, first.tab.fov, first.tab.roll);
+
+	passed &= Check(first.frameTimes.size() == recording.GetFrameCount(), "every recorded frame should be replayed");
+	passed &= Check(first.vertices == second.vertices && first.tab == second.tab, "replaying a session twice should draw the same frames and end in the same state");
+	passed &= Check(first.tab.index != 0, "the replay should have picked an item from the filtered combo");
+	passed &= Check(first.tab.fov != 70.0f || first.tab.roll != 0.0f, "the replay should have dragged a slider");
+
+	return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <set>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace std::literals;
+
+// stands in for clib_util::singleton, so that the tests don't need the plugin's dependencies
+template <class T>
+class ISingleton
+{
+public:
+	static T* GetSingleton()
+	{
+		static T singleton;
+		return std::addressof(singleton);
+	}
+
+protected:
+	ISingleton() = default;
+	~ISingleton() = default;
+
+	ISingleton(const ISingleton&) = delete;
+	ISingleton(ISingleton&&) = delete;
+	ISingleton& operator=(const ISingleton&) = delete;
+	ISingleton& operator=(ISingleton&&) = delete;
+};
+
+// the engine's input devices, for the recorded input events
+namespace RE
+{
+	enum class INPUT_DEVICE : std::uint32_t
+	{
+		kKeyboard,
+		kMouse,
+		kGamepad,
+		kVirtualKeyboard
+	};
+}
+
+#include "FrameArena.h"
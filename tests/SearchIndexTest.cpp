@@ -0,0 +1,78 @@
+#include "ImGui/SearchIndex.h"
+#include "TestItems.h"
+
+#include <rapidfuzz/rapidfuzz_all.hpp>
+
+namespace
+{
+	constexpr double scoreCutoff{ 65.0 };  // ComboFilter::scoreCutoff
+
+	bool Check(bool a_condition, const char* a_message, std::string_view a_pattern)
+	{
+		if (!a_condition) {
+			std::fprintf(stderr, "FAILED: %s (\"%.*s\")\n", a_message, static_cast<int>(a_pattern.size()), a_pattern.data());
+		}
+		return a_condition;
+	}
+}
+
+int main()
+{
+	static constexpr std::array patterns{ "i", "ir", "iro", "iron", "Iron", "iron dag", "Steel Dagger", "Dagger Dagger", "DLC2Spider", "idle sit", "IdleSitLean", "xyz", "Frost Weather 12", "MQ101Torch", "  " };
+
+	const auto                    items = Test::GenerateItems(50000);
+	std::vector<std::string_view> views(items.begin(), items.end());
+
+	ImGui::SearchIndex index;
+	index.Build(views);
+
+	using clock = std::chrono::steady_clock;
+
+	bool                      passed = true;
+	std::vector<std::int32_t> candidates;
+
+	for (const std::string_view pattern : patterns) {
+		const rapidfuzz::fuzz::CachedPartialTokenRatio<char> scorer(pattern);
+
+		auto       start = clock::now();
+		const bool indexed = index.GetCandidates(pattern, scoreCutoff, 0, static_cast<std::int32_t>(views.size()), candidates);
+		if (!indexed) {
+			candidates.resize(views.size());
+			std::iota(candidates.begin(), candidates.end(), 0);
+		}
+		std::size_t indexedMatches = 0;
+		for (const auto& idx : candidates) {
+			indexedMatches += scorer.similarity(views[idx], scoreCutoff) >= scoreCutoff;
+		}
+		const auto indexedTime = clock::now() - start;
+		const auto candidateCount = candidates.size();
+
+		start = clock::now();
+		std::vector<std::int32_t> matches;
+		for (std::int32_t i = 0; i < static_cast<std::int32_t>(views.size()); ++i) {
+			if (scorer.similarity(views[i], scoreCutoff) >= scoreCutoff) {
+				matches.push_back(i);
+			}
+		}
+		const auto fullTime = clock::now() - start;
+
+		passed &= Check(std::ranges::includes(candidates, matches), "the index skipped an item that passes the cutoff", pattern);
+		passed &= Check(indexedMatches == matches.size(), "scoring the candidates found a different number of matches", pattern);
+
+		// a mod's range of a catalogue
+		constexpr std::int32_t first = 1000;
+		constexpr std::int32_t count = 5000;
+		if (index.GetCandidates(pattern, scoreCutoff, first, count, candidates)) {
+			std::vector<std::int32_t> rangeMatches;
+			std::ranges::copy_if(matches, std::back_inserter(rangeMatches), [](std::int32_t a_idx) { return a_idx >= first && a_idx < first + count; });
+			passed &= Check(std::ranges::all_of(candidates, [](std::int32_t a_idx) { return a_idx >= first && a_idx < first + count; }), "a candidate is outside the range", pattern);
+			passed &= Check(std::ranges::includes(candidates, rangeMatches), "the index skipped an item of the range that passes the cutoff", pattern);
+		}
+
+		const auto ms = [](clock::duration a_duration) { return std::chrono::duration<double, std::milli>(a_duration).count(); };
+		std::printf("%-18s %6zu matches, %6zu candidates (%5.1f%%), %8.2f ms indexed, %8.2f ms full scan\n",
+			("\"" + std::string(pattern) + "\"").c_str(), matches.size(), candidateCount, 100.0 * candidateCount / views.size(), ms(indexedTime), ms(fullTime));
+	}
+
+	return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+namespace Test
+{
+	// EditorID and display name shaped items, e.g. "DLC2IronSwordBlades03" or "Steel Dagger of Frost"
+	inline std::vector<std::string> GenerateItems(std::size_t a_count)
+	{
+		static constexpr std::array prefixes{ "", "", "", "DLC1", "DLC2", "CC", "MQ101", "zzz" };
+		static constexpr std::array words{ "Iron", "Steel", "Dagger", "Sword", "Idle", "Spider", "Frost", "Bow", "Ebony", "Glass", "Daedric",
+			"Leather", "Boots", "Helmet", "Sit", "Lean", "Wall", "Dance", "Drunk", "Torch", "Fire", "Shock", "Weather", "Snow", "Storm", "iron", "sword" };
+
+		std::mt19937                                 rng{ 42 };
+		std::uniform_int_distribution<std::size_t>   prefix{ 0, prefixes.size() - 1 };
+		std::uniform_int_distribution<std::size_t>   word{ 0, words.size() - 1 };
+		std::uniform_int_distribution<std::size_t>   wordCount{ 1, 4 };
+		std::uniform_int_distribution<std::uint32_t> number{ 0, 99 };
+		std::bernoulli_distribution                  spaced{ 0.3 };
+
+		std::vector<std::string> items;
+		items.reserve(a_count);
+		for (std::size_t i = 0; i < a_count; ++i) {
+			const bool  displayName = spaced(rng);
+			std::string item = displayName ? "" : prefixes[prefix(rng)];
+			for (std::size_t j = 0, count = wordCount(rng); j < count; ++j) {
+				if (displayName && j > 0) {
+					item += ' ';
+				}
+				item += words[word(rng)];
+			}
+			if (!displayName) {
+				item += std::to_string(number(rng));
+			}
+			items.push_back(std::move(item));
+		}
+		return items;
+	}
+}
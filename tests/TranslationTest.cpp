@@ -0,0 +1,139 @@
+#include "TranslationFile.h"
+
+namespace
+{
+	constexpr std::size_t translationCount{ 184 };
+
+	bool Check(bool a_condition, const char* a_message, const std::filesystem::path& a_path)
+	{
+		if (!a_condition) {
+			std::fprintf(stderr, "FAILED: %s (%s)\n", a_message, a_path.filename().string().c_str());
+		}
+		return a_condition;
+	}
+
+	// UTF-16 buffer, so that the bytes are 2-byte aligned like the mapped view
+	std::vector<char16_t> ReadFile(const std::filesystem::path& a_path)
+	{
+		std::ifstream   stream(a_path, std::ios::binary);
+		std::error_code ec;
+		const auto      size = std::filesystem::file_size(a_path, ec);
+
+		std::vector<char16_t> buffer(ec ? 0 : (size + 1) / sizeof(char16_t));
+		stream.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(size));
+		return buffer;
+	}
+
+	std::set<std::string_view> GetKeys(const Translation::File& a_file)
+	{
+		std::set<std::string_view> keys;
+		for (const auto& [key, value] : a_file.GetEntries()) {
+			keys.insert(key);
+		}
+		return keys;
+	}
+
+	bool TestFile(const std::filesystem::path& a_path, const std::set<std::string>& a_englishKeys, const std::filesystem::path& a_cacheFolder)
+	{
+		bool passed = true;
+
+		const auto buffer = ReadFile(a_path);
+		const auto bytes = std::as_bytes(std::span(buffer));
+		const auto fileHash = Translation::HashKey({ reinterpret_cast<const char*>(bytes.data()), bytes.size() });
+
+		Translation::File file;
+		if (!Check(file.Parse(bytes), "the file should have a UTF-16 LE BOM", a_path)) {
+			return false;
+		}
+
+		const auto entries = file.GetEntries();
+		const auto keys = GetKeys(file);
+		passed &= Check(entries.size() == translationCount, "every line should be a translation", a_path);
+		passed &= Check(keys.size() == entries.size(), "keys should be unique", a_path);
+		passed &= Check(std::ranges::equal(keys, a_englishKeys), "keys should match the English file", a_path);
+		passed &= Check(std::ranges::all_of(entries, [](const auto& a_entry) { return a_entry.first.starts_with("$PM_"); }), "keys should start with $PM_", a_path);
+		passed &= Check(std::ranges::none_of(entries, [](const auto& a_entry) { return a_entry.second.empty() || a_entry.second.ends_with('\r') || a_entry.second.starts_with(' '); }), "values should be trimmed and not empty", a_path);
+		passed &= Check(std::ranges::all_of(entries, [](const auto& a_entry) { return a_entry.first.data()[a_entry.first.size()] == '\0' && a_entry.second.data()[a_entry.second.size()] == '\0'; }), "keys and values should be null-terminated", a_path);
+
+		// cache round trip
+		const auto cachePath = a_cacheFolder / a_path.filename().replace_extension(".bin");
+		passed &= Check(file.SaveCache(cachePath, fileHash), "the cache should be written", a_path);
+
+		Translation::File cached;
+		passed &= Check(cached.LoadCache(cachePath, fileHash) == Translation::File::CacheResult::kLoaded, "the cache should load", a_path);
+		passed &= Check(std::ranges::equal(cached.GetEntries(), entries), "the cache should load the parsed translations", a_path);
+		passed &= Check(std::ranges::equal(cached.GetText(), file.GetText()), "the cache should load the parsed text", a_path);
+
+		Translation::File stale;
+		passed &= Check(stale.LoadCache(cachePath, fileHash + 1) == Translation::File::CacheResult::kMissing, "a cache of another file should not load", a_path);
+
+		std::filesystem::resize_file(cachePath, std::filesystem::file_size(cachePath) - 1);
+		Translation::File truncated;
+		passed &= Check(truncated.LoadCache(cachePath, fileHash) == Translation::File::CacheResult::kCorrupt, "a truncated cache should not load", a_path);
+
+		if (passed) {
+			std::printf("%s: %zu translations, %zu bytes of UTF-8\n", a_path.filename().string().c_str(), entries.size(), file.GetText().size());
+		}
+
+		return passed;
+	}
+}
+
+int main()
+{
+	const std::filesystem::path translations{ TRANSLATIONS_FOLDER };
+	const auto                  cacheFolder = std::filesystem::temp_directory_path() / "PhotoModeTranslationTest";
+
+	std::vector<std::filesystem::path> paths;
+	for (const auto& entry : std::filesystem::directory_iterator(translations)) {
+		if (const auto name = entry.path().filename().string(); name.starts_with("PhotoMode_") && name.ends_with(".txt")) {
+			paths.push_back(entry.path());
+		}
+	}
+	std::ranges::sort(paths);
+
+	std::set<std::string> englishKeys;
+	{
+		const auto        buffer = ReadFile(translations / "PhotoMode_ENGLISH.txt");
+		Translation::File english;
+		english.Parse(std::as_bytes(std::span(buffer)));
+		for (const auto& key : GetKeys(english)) {
+			englishKeys.emplace(key);
+		}
+	}
+
+	bool passed = !paths.empty() && englishKeys.size() == translationCount;
+	if (!passed) {
+		std::fprintf(stderr, "FAILED: no translation files, or the English file is incomplete, in %s\n", translations.string().c_str());
+	}
+
+	for (const auto& path : paths) {
+		passed &= TestFile(path, englishKeys, cacheFolder);
+	}
+
+	// the shipped files are all English so far, so transcoding is checked on its own: 2, 3 and 4 byte UTF-8, tabs, CRLF and blank lines
+	{
+		constexpr std::u16string_view content{ u"\uFEFF$PM_A\t\u00C5ngstr\u00F6m\r\n\r\n  $PM_B   \u4E2D\u6587\r\n$PM_C \U0001F600\n" };
+		Translation::File              file;
+		const bool                     parsed = file.Parse(std::as_bytes(std::span(content)));
+
+		const std::array<std::pair<std::string_view, std::string_view>, 3> expected{ {
+			{ "$PM_A", "\xC3\x85ngstr\xC3\xB6m" },
+			{ "$PM_B", "\xE4\xB8\xAD\xE6\x96\x87" },
+			{ "$PM_C", "\xF0\x9F\x98\x80" },
+		} };
+		passed &= Check(parsed && std::ranges::equal(file.GetEntries(), expected), "UTF-16 should be transcoded to UTF-8 and trimmed", "synthetic");
+	}
+
+	// not a BOM
+	{
+		constexpr std::array<std::byte, 4> utf8{ std::byte{ '$' }, std::byte{ 'P' }, std::byte{ 'M' }, std::byte{ '_' } };
+		Translation::File                  file;
+		passed &= Check(!file.Parse(utf8), "a file without a UTF-16 LE BOM should be rejected", "utf8");
+	}
+
+	std::error_code ec;
+	std::filesystem::remove_all(cacheFolder, ec);
+
+	return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}